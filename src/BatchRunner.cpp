@@ -0,0 +1,453 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar batch runner; handles sweeps over benchmarks, configs, die
+ *    counts and seeds within one process
+ *
+ *    Copyright (C) 2013-2016 Johann Knechtel, johann aett jknechtel dot de
+ *
+ *    This file is part of Corblivar.
+ *
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// own Corblivar header
+#include "BatchRunner.hpp"
+// required Corblivar headers
+#include "CorblivarCore.hpp"
+#include "FloorPlanner.hpp"
+#include "IO.hpp"
+#include "Math.hpp"
+// required library headers
+#include <sys/stat.h>
+
+/// memory allocation
+thread_local std::streambuf* BatchRunner::log_target = nullptr;
+
+void BatchRunner::run(int const& argc, char** argv) {
+	std::vector<BatchRunner::Job> jobs;
+	std::map<std::string, std::mutex> benchmark_image_mutexes;
+	std::vector<std::thread> threads;
+	std::atomic<unsigned> next_job(0);
+	std::mutex console_mutex;
+	std::streambuf* console;
+	unsigned thread_count;
+
+	if (argc < 3) {
+		std::cout << "Batch> Usage: " << argv[0] << " --batch manifest_file [threads]" << std::endl;
+		std::cout << "Batch> " << std::endl;
+		std::cout << "Batch> Mandatory parameter ``manifest_file'': one job per line, as ``benchmark_name config_file benchmarks_dir die_count seed [solution_file]''" << std::endl;
+		std::cout << "Batch> Optional parameter ``threads'': number of concurrent jobs; by default, the number of hardware threads" << std::endl;
+
+		exit(1);
+	}
+
+	BatchRunner::parseManifest(argv[2], jobs);
+
+	if (argc > 3) {
+		thread_count = std::max(1, atoi(argv[3]));
+	}
+	else {
+		thread_count = std::max(1u, std::thread::hardware_concurrency());
+	}
+	thread_count = std::min(thread_count, static_cast<unsigned>(jobs.size()));
+
+	std::cout << "Batch> Jobs: " << jobs.size() << "; threads: " << thread_count << std::endl;
+	std::cout << std::endl;
+
+	// init output dirs and mutexes for benchmark images
+	for (BatchRunner::Job const& job : jobs) {
+		BatchRunner::createDir(job.output_dir);
+		benchmark_image_mutexes[job.benchmark_image_file];
+	}
+
+	// redirect std::cout; all output is written into the log of the calling thread
+	console = std::cout.rdbuf();
+	BatchRunner::LogDispatcher dispatcher(console);
+	std::cout.rdbuf(&dispatcher);
+
+	// helper for console output, w/ whole lines being written at once
+	auto logConsole = [&](std::string const& line) {
+		std::lock_guard<std::mutex> lock(console_mutex);
+		console->sputn(line.data(), line.size());
+		console->pubsync();
+	};
+
+	// jobs are distributed dynamically; each thread takes the next job as soon as it
+	// is done w/ its current job
+	//
+	auto worker = [&]() {
+		// the output files of a job are generated in background, see
+		// FloorPlanner::finalize; the related data and log are thus held until
+		// the next job is done, allowing for overlap of output and computation
+		struct JobContext {
+			std::ofstream log;
+			std::unique_ptr<FloorPlanner> fp;
+		};
+		std::unique_ptr<JobContext> previous, current;
+		unsigned j;
+
+		while ((j = next_job++) < jobs.size()) {
+			BatchRunner::Job& job = jobs[j];
+			std::stringstream line;
+
+			line << "Batch> Job " << j + 1 << "/" << jobs.size() << " started: " << job.output_dir << job.benchmark << ".log" << std::endl;
+			logConsole(line.str());
+
+			current.reset(new JobContext());
+			current->log.open((job.output_dir + job.benchmark + ".log").c_str());
+			current->fp.reset(new FloorPlanner());
+
+			BatchRunner::log_target = current->log.rdbuf();
+			BatchRunner::runJob(job, *(current->fp), benchmark_image_mutexes[job.benchmark_image_file]);
+			BatchRunner::log_target = nullptr;
+
+			// the results file is completed w/ the finalize run
+			BatchRunner::parseResults(job);
+
+			line.str("");
+			line << "Batch> Job " << j + 1 << "/" << jobs.size() << " done: " << job.output_dir << job.benchmark << ".results" << std::endl;
+			logConsole(line.str());
+
+			previous = std::move(current);
+		}
+	};
+
+	for (unsigned t = 0; t < thread_count; t++) {
+		threads.emplace_back(worker);
+	}
+	for (std::thread& t : threads) {
+		t.join();
+	}
+
+	std::cout.rdbuf(console);
+	std::cout << std::endl;
+
+	BatchRunner::writeSummaries(jobs);
+}
+
+void BatchRunner::parseManifest(std::string const& manifest_file, std::vector<BatchRunner::Job>& jobs) {
+	std::ifstream in;
+	std::ifstream config;
+	std::string line;
+	std::string config_name, exp_name;
+	std::set<std::string> output_dirs;
+	size_t pos;
+	unsigned line_count;
+
+	in.open(manifest_file.c_str());
+	if (!in.good()) {
+		std::cout << "Batch> ";
+		std::cout << "No such manifest file: " << manifest_file << std::endl;
+		exit(1);
+	}
+
+	line_count = 0;
+	while (std::getline(in, line)) {
+		std::istringstream tokens(line);
+		BatchRunner::Job job;
+
+		line_count++;
+
+		// ignore empty lines and comments
+		if (!(tokens >> job.benchmark) || job.benchmark[0] == '#') {
+			continue;
+		}
+
+		if (!(tokens >> job.config_file >> job.benchmarks_dir >> job.layers >> job.seed) || job.layers <= 0) {
+			std::cout << "Batch> ";
+			std::cout << "Invalid job in manifest file, line " << line_count << ": " << line << std::endl;
+			exit(1);
+		}
+		// optional solution file
+		tokens >> job.solution_file;
+
+		// test config file
+		config.open(job.config_file.c_str());
+		if (!config.good()) {
+			std::cout << "Batch> ";
+			std::cout << "No such config file: " << job.config_file << "; manifest file, line " << line_count << std::endl;
+			exit(1);
+		}
+		config.close();
+
+		// config name; file name w/o path and extension, prefixed by the name of
+		// the parent dir, if any, i.e., the experiment as for exp/run*.sh; the
+		// experiments in exp/configs/ share the file names of configs
+		config_name = job.config_file;
+		exp_name.clear();
+
+		pos = config_name.find_last_of('/');
+		if (pos != std::string::npos) {
+			exp_name = config_name.substr(0, pos);
+			config_name = config_name.substr(pos + 1);
+
+			pos = exp_name.find_last_of('/');
+			if (pos != std::string::npos) {
+				exp_name = exp_name.substr(pos + 1);
+			}
+			if (exp_name == "." || exp_name == "..") {
+				exp_name.clear();
+			}
+		}
+		pos = config_name.find_last_of('.');
+		if (pos != std::string::npos && pos > 0) {
+			config_name = config_name.substr(0, pos);
+		}
+
+		// benchmarks dir is expected w/ trailing slash, as for regular Corblivar
+		// calls
+		if (job.benchmarks_dir.back() != '/') {
+			job.benchmarks_dir += "/";
+		}
+
+		if (exp_name.empty()) {
+			job.output_dir = std::to_string(job.layers) + "dies/" + config_name + "/" + std::to_string(job.seed) + "/";
+			job.benchmark_image_file = job.benchmark + "_" + config_name + ".image";
+			job.summary_file = job.benchmark + "_" + config_name + "_" + std::to_string(job.layers) + "dies.results";
+		}
+		else {
+			job.output_dir = std::to_string(job.layers) + "dies/" + exp_name + "/" + config_name + "/" + std::to_string(job.seed) + "/";
+			job.benchmark_image_file = job.benchmark + "_" + exp_name + "_" + config_name + ".image";
+			job.summary_file = job.benchmark + "_" + exp_name + "_" + config_name + "_" + std::to_string(job.layers) + "dies.results";
+		}
+
+		// jobs w/ same output, i.e., same benchmark, experiment, config, die
+		// count and seed, must not be run concurrently
+		if (!output_dirs.insert(job.output_dir + job.benchmark).second) {
+			std::cout << "Batch> ";
+			std::cout << "Duplicate job in manifest file, line " << line_count << ": " << line << std::endl;
+			exit(1);
+		}
+
+		jobs.push_back(job);
+	}
+
+	if (jobs.empty()) {
+		std::cout << "Batch> ";
+		std::cout << "No jobs in manifest file: " << manifest_file << std::endl;
+		exit(1);
+	}
+}
+
+void BatchRunner::runJob(BatchRunner::Job const& job, FloorPlanner& fp, std::mutex& benchmark_image_mutex) {
+	std::vector<std::string> args;
+	std::vector<char*> argv;
+
+	// command-line parameters, as for regular Corblivar call
+	args = {"Corblivar", job.benchmark, job.config_file, job.benchmarks_dir};
+	if (!job.solution_file.empty()) {
+		args.push_back(job.solution_file);
+	}
+	for (std::string& arg : args) {
+		argv.push_back(&arg[0]);
+	}
+
+	// the sequence of random numbers is defined by the job's seed, not by the
+	// time as for regular Corblivar calls
+	Math::seedRand(job.seed);
+
+	fp.IO_conf.output_dir = job.output_dir;
+
+	std::cout << std::endl;
+	std::cout << "Corblivar: Corner Block List for Varied [Block] Alignment Requests" << std::endl;
+	std::cout << "----- 3D floorplanning tool v 1.4.4 ------------------------------" << std::endl << std::endl;
+	std::cout << "Batch> Job: " << job.benchmark << " " << job.config_file << " " << job.benchmarks_dir << " " << job.layers << " " << job.seed << " " << job.solution_file << std::endl << std::endl;
+
+	// parse program parameter, config file, and further files
+	IO::parseParametersFiles(fp, argv.size(), argv.data());
+
+	// apply die count of job; see also IO::parseParametersFiles
+	fp.IC.layers = job.layers;
+	fp.layoutOp.parameters.layers = job.layers;
+	fp.voltageAssignment.parameters.layers = job.layers;
+	fp.IC.stack_area = fp.IC.die_area * fp.IC.layers;
+
+	if (fp.logMin()) {
+		std::cout << "Batch> Die count applied: " << fp.IC.layers << std::endl << std::endl;
+	}
+
+	// parse blocks and nets; the first job for the benchmark and config generates
+	// the shared benchmark image, other jobs wait for and then load that image
+	fp.IO_conf.benchmark_image_file = job.benchmark_image_file;
+	{
+		std::lock_guard<std::mutex> lock(benchmark_image_mutex);
+
+		IO::parseBlocks(fp);
+		IO::parseNets(fp);
+	}
+
+	// generate DAG (directed acyclic graph) for SL-STA (system-level static timing analysis)
+	fp.initTimingPowerAnalyser();
+
+	// init Corblivar core
+	CorblivarCore corb = CorblivarCore(fp.getLayers(), fp.getBlocks().size());
+
+	// parse alignment request
+	IO::parseAlignmentRequests(fp, corb.editAlignments());
+
+	// init thermal analyzer, only reasonable after parsing config file
+	fp.initThermalAnalyzer();
+
+	// init routing-utilization analyzer
+	fp.initRoutingUtilAnalyzer();
+
+	// the output files are generated in background, concurrently w/ the next job
+	//
+	// non-regular run; read in solution file
+	if (fp.inputSolutionFileOpen()) {
+
+		// read from file
+		IO::parseCorblivarFile(fp, corb);
+
+		// assume read in data as currently best solution
+		corb.storeBestCBLs();
+
+		// overall cost is not determined; cost cannot be determined since no
+		// normalization during SA search was performed
+		fp.finalize(corb, false, true, false);
+	}
+	// regular run; perform floorplanning
+	else {
+		// resume from checkpoint; data set is restored during SA
+		if (!fp.resumeFromCheckpoint()) {
+			// generate new, random data set
+			corb.initCorblivarRandomly(fp.logMed(), fp.getLayers(), fp.getBlocks(), fp.powerAwareBlockHandling());
+		}
+
+		// perform SA; main handler
+		fp.performSA(corb);
+
+		// finalize: generate output files, final logging
+		fp.finalize(corb, true, true, false);
+	}
+}
+
+/// all lines of the form ``criterion: value'' w/ numerical values are considered
+void BatchRunner::parseResults(BatchRunner::Job& job) {
+	std::ifstream in;
+	std::string line;
+	std::string criterion;
+	size_t pos;
+	double value;
+
+	in.open((job.output_dir + job.benchmark + ".results").c_str());
+
+	while (std::getline(in, line)) {
+
+		pos = line.find_last_of(':');
+		if (pos == std::string::npos) {
+			continue;
+		}
+
+		std::istringstream value_stream(line.substr(pos + 1));
+		if (!(value_stream >> value)) {
+			continue;
+		}
+
+		criterion = line.substr(0, pos);
+		criterion = criterion.substr(std::min(criterion.find_first_not_of(' '), criterion.size()));
+
+		job.results.emplace_back(criterion, value);
+	}
+}
+
+void BatchRunner::writeSummaries(std::vector<BatchRunner::Job> const& jobs) {
+	std::map< std::string, std::vector<BatchRunner::Job const*> > summaries;
+	std::vector<std::string> criteria;
+	std::vector< std::vector<double> > values;
+	std::ofstream out;
+	unsigned c;
+
+	for (BatchRunner::Job const& job : jobs) {
+		summaries[job.summary_file].push_back(&job);
+	}
+
+	for (auto const& summary : summaries) {
+
+		// determine all criteria, in order of their appearance in the results
+		// files
+		criteria.clear();
+		for (BatchRunner::Job const* job : summary.second) {
+			for (auto const& result : job->results) {
+				if (std::find(criteria.begin(), criteria.end(), result.first) == criteria.end()) {
+					criteria.push_back(result.first);
+				}
+			}
+		}
+
+		out.open(summary.first.c_str());
+
+		out << "# Seed";
+		for (std::string const& criterion : criteria) {
+			out << "	" << criterion;
+		}
+		out << "\n";
+
+		// one row for each job, one column for each criterion
+		values.assign(criteria.size(), std::vector<double>());
+		for (BatchRunner::Job const* job : summary.second) {
+
+			out << job->seed;
+
+			for (c = 0; c < criteria.size(); c++) {
+
+				auto result = std::find_if(job->results.begin(), job->results.end(), [&](std::pair<std::string, double> const& r) {
+					return r.first == criteria[c];
+				});
+
+				if (result != job->results.end()) {
+					out << "	" << result->second;
+					values[c].push_back(result->second);
+				}
+				else {
+					out << "	N/A";
+				}
+			}
+			out << "\n";
+		}
+
+		// avg and std dev over all jobs which provide the criterion
+		out << "\n";
+		out << "# Avg";
+		for (c = 0; c < criteria.size(); c++) {
+			double avg = 0.0;
+			for (double const& v : values[c]) {
+				avg += v;
+			}
+			out << "	" << (values[c].empty() ? 0.0 : avg / values[c].size());
+		}
+		out << "\n";
+		out << "# Std dev";
+		for (c = 0; c < criteria.size(); c++) {
+			out << "	" << (values[c].empty() ? 0.0 : Math::stdDev(values[c]));
+		}
+		out << "\n";
+
+		out.close();
+
+		std::cout << "Batch> Summary written: " << summary.first << "; jobs: " << summary.second.size() << std::endl;
+	}
+
+	std::cout << std::endl;
+}
+
+void BatchRunner::createDir(std::string const& dir) {
+	size_t pos;
+
+	pos = 0;
+	while ((pos = dir.find('/', pos + 1)) != std::string::npos) {
+		mkdir(dir.substr(0, pos).c_str(), 0755);
+	}
+}
@@ -0,0 +1,137 @@
+/**
+ * =====================================================================================
+ *
+ *    Description:  Corblivar batch runner; handles sweeps over benchmarks, configs, die
+ *    counts and seeds within one process
+ *
+ *    Copyright (C) 2013-2016 Johann Knechtel, johann aett jknechtel dot de
+ *
+ *    This file is part of Corblivar.
+ *
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_BATCH_RUNNER
+#define _CORBLIVAR_BATCH_RUNNER
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+// forward declarations, if any
+class FloorPlanner;
+
+/// Corblivar batch runner
+///
+/// the jobs are given in a manifest file, one job per line, as ``benchmark_name
+/// config_file benchmarks_dir die_count seed [solution_file]''; empty lines and lines
+/// starting w/ # are ignored
+///
+/// the jobs are run concurrently; each job is run like a separate Corblivar call, but
+/// w/ its own output dir ``DIES/EXP/CONFIG/SEED/'', similar to exp/run*.sh, where DIES
+/// is the die count suffixed by ``dies'', EXP is the name of the config file's parent
+/// dir (omitted if the config file is given w/o path), and CONFIG is the config file's
+/// name w/o extension; the logging of each job is written into BENCH.log in its output
+/// dir
+///
+/// if benchmark images are activated in the config, the benchmark files are parsed
+/// only once for each benchmark, experiment and config; all related jobs share one
+/// benchmark image, see FloorPlanner::IO_conf::benchmark_image, stored in the working
+/// dir
+///
+/// finally, for each benchmark, experiment, config and die count, a summary
+/// BENCH_EXP_CONFIG_DIES.results is written into the working dir, similar to
+/// exp/extract_average_results.sh; it lists all numerical values of the jobs' results
+/// files, along w/ their avg and std dev
+class BatchRunner {
+	private:
+		/// debugging code switch (private)
+		static constexpr bool DBG = false;
+
+	// private data, functions
+	private:
+		/// POD for jobs
+		struct Job {
+			std::string benchmark, config_file, benchmarks_dir, solution_file;
+			int layers;
+			unsigned seed;
+			/// output dir, incl. trailing slash
+			std::string output_dir;
+			/// benchmark image, shared among jobs
+			std::string benchmark_image_file;
+			/// summary, shared among jobs for same benchmark, config and die
+			/// count
+			std::string summary_file;
+			/// results; criteria and values parsed from results file
+			std::vector< std::pair<std::string, double> > results;
+		};
+
+		/// redirects all output to std::cout into the log of the calling thread,
+		/// as defined by log_target; required since the logging of all
+		/// Corblivar components is based on std::cout
+		class LogDispatcher : public std::streambuf {
+			private:
+				std::streambuf* console;
+
+				inline std::streambuf* target() {
+					return (BatchRunner::log_target != nullptr) ? BatchRunner::log_target : this->console;
+				};
+
+			protected:
+				int_type overflow(int_type c) {
+					if (traits_type::eq_int_type(c, traits_type::eof())) {
+						return traits_type::not_eof(c);
+					}
+					return this->target()->sputc(traits_type::to_char_type(c));
+				};
+				std::streamsize xsputn(char const* s, std::streamsize n) {
+					return this->target()->sputn(s, n);
+				};
+				int sync() {
+					return this->target()->pubsync();
+				};
+
+			public:
+				LogDispatcher(std::streambuf* console) : console(console) {
+				}
+		};
+
+		/// parse manifest file; init jobs
+		static void parseManifest(std::string const& manifest_file, std::vector<Job>& jobs);
+		/// run a single job; the flow is the same as in main(); the parsing of
+		/// benchmark files is guarded by the mutex of the job's benchmark image
+		static void runJob(Job const& job, FloorPlanner& fp, std::mutex& benchmark_image_mutex);
+		/// parse the job's results file
+		static void parseResults(Job& job);
+		/// write all summaries
+		static void writeSummaries(std::vector<Job> const& jobs);
+		/// create dir, including all parent dirs
+		static void createDir(std::string const& dir);
+
+	// constructors, destructors, if any non-implicit
+	private:
+		/// empty default constructor; private in order to avoid instances of ``static'' class
+		BatchRunner() {
+		}
+
+	// public data, functions
+	public:
+		/// target for std::cout of the calling thread; nullptr refers to the
+		/// console; to be propagated to threads spawned w/in a job, see
+		/// FloorPlanner::finalize
+		static thread_local std::streambuf* log_target;
+
+		/// batch-mode handler; call as ``Corblivar --batch manifest_file [threads]''
+		static void run(int const& argc, char** argv);
+};
+
+#endif
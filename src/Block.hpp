@@ -226,9 +226,6 @@ class Block {
 			}
 		}
 
-		/// vector of contiguous neighbours, required for voltage assignment
-		mutable std::vector<ContiguityAnalysis::ContiguousNeighbour> contiguous_neighbours;
-
 		/// rectangle, represents block geometry and placement
 		mutable Rect bb, bb_backup, bb_best;
 
@@ -347,16 +344,28 @@ class Block {
 			return this->power_max();
 		}
 
-		/// search blocks
-		inline static Block const* findBlock(std::string const& id, std::vector<Block> const& container) {
+		/// search blocks; via symbol table, which maps ids to indices of container
+		inline static Block const* findBlock(std::string const& id, std::vector<Block> const& container, std::unordered_map<std::string, unsigned> const& ids) {
+			auto it = ids.find(id);
 
-			for (Block const& b : container) {
-				if (b.id == id) {
-					return &b;
-				}
+			if (it == ids.end()) {
+				return nullptr;
 			}
 
-			return nullptr;
+			return &container[it->second];
+		};
+
+		/// init symbol table for search of blocks (or pins), i.e., map ids to indices of container
+		template<typename T>
+		inline static void initIds(std::vector<T> const& container, std::unordered_map<std::string, unsigned>& ids) {
+
+			ids.clear();
+			ids.reserve(container.size());
+
+			for (unsigned i = 0; i < container.size(); i++) {
+				// only first occurrence is memorized for duplicate ids, as for previous linear search
+				ids.emplace(container[i].id, i);
+			}
 		};
 
 		friend std::ostream& operator<< (std::ostream& out, AlignmentStatus const& status) {
@@ -401,16 +410,15 @@ class Pin : public Block {
 			this->layer = LAYER;
 		};
 
-		/// search pins
-		inline static Pin const* findPin(std::string const& id, std::vector<Pin> const& container) {
+		/// search pins; via symbol table, which maps ids to indices of container
+		inline static Pin const* findPin(std::string const& id, std::vector<Pin> const& container, std::unordered_map<std::string, unsigned> const& ids) {
+			auto it = ids.find(id);
 
-			for (Pin const& b : container) {
-				if (b.id == id) {
-					return &b;
-				}
+			if (it == ids.end()) {
+				return nullptr;
 			}
 
-			return nullptr;
+			return &container[it->second];
 		};
 };
 
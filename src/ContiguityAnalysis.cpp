@@ -30,42 +30,52 @@
 /// Extract blocks' boundaries, and order them by coordinates; this will reduce required
 /// comparisons between (in principal all pairs of) blocks notably by considering only
 /// relevant blocks. For intra-die contiguity, these are abutting boundaries, and for
-/// inter-die contiguity, these are boundaries within a block's outline.
+/// inter-die contiguity, these are boundaries within a block's outline. The ordered
+/// boundaries are walked in a sweep-line manner, and any contiguous pair of blocks is
+/// memorized in a flat list, from which the flat adjacency array is derived.
 ///
 void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blocks) {
 
 	ContiguityAnalysis::Boundary cur_boundary;
 
-	// this data structure is used for inter-die contiguity analysis; note and see
-	// below that considering / walking one dimension's boundaries is sufficient to
-	// determine intersections in both dimensions / overlaps
-	std::vector< std::vector<ContiguityAnalysis::Boundary> > inter_die_boundaries_vert;
-
 	std::vector<ContiguityAnalysis::Boundary>::iterator i1;
 	std::vector<ContiguityAnalysis::Boundary>::iterator i2;
 	// (TODO) drop; not required as of now
 //	double common_boundary_hor, common_boundary_vert;
 
-	// init die-wise lists of boundaries
-	this->boundaries_hor.clear();
-	this->boundaries_hor.reserve(layers);
-	this->boundaries_vert.clear();
-	this->boundaries_vert.reserve(layers);
-	inter_die_boundaries_vert.reserve(layers - 1);
+	// the placement has not changed since the previous analysis; the previous
+	// contiguous neighbours remain valid
+	//
+	// note that this happens, e.g., for re-evaluations of the same layout after die
+	// shrinking, or for finalize runs
+	if (!this->placementChanged(layers, blocks)) {
+
+		if (ContiguityAnalysis::DBG) {
+			std::cout << "DBG_CONTIGUITY> Placement unchanged; skip analysis" << std::endl;
+		}
+
+		return;
+	}
+
+	// init die-wise lists of boundaries; reset previous boundaries but keep the
+	// lists' capacity
+	this->boundaries_hor.resize(layers);
+	this->boundaries_vert.resize(layers);
+	this->inter_die_boundaries_vert.resize(std::max(0, layers - 1));
 	for (int l = 0; l < layers; l++) {
-		this->boundaries_hor.push_back(std::vector<ContiguityAnalysis::Boundary>());
-		this->boundaries_vert.push_back(std::vector<ContiguityAnalysis::Boundary>());
+		this->boundaries_hor[l].clear();
+		this->boundaries_vert[l].clear();
 	}
 	for (int l = 0; l < layers - 1; l++) {
-		inter_die_boundaries_vert.push_back(std::vector<ContiguityAnalysis::Boundary>());
+		this->inter_die_boundaries_vert[l].clear();
 	}
 
+	// reset previous contiguous pairs
+	this->contiguous_pairs.clear();
+
 	// add blocks' boundaries into corresponding list
 	for (Block const& block : blocks) {
 
-		// reset previous contiguous neighbours
-		block.contiguous_neighbours.clear();
-
 		cur_boundary.block = &block;
 
 		// left boundary
@@ -80,17 +90,22 @@ void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blo
 		// inter-die contiguity; merge left boundaries for adjacent dies' blocks
 		// into one layer of inter_die_boundaries, such that determination of
 		// inter-die contiguity will be simplified
-		if (block.layer == 0) {
-			inter_die_boundaries_vert[0].push_back(cur_boundary);
+		//
+		// sanity check for 2D setups, i.e., no inter-die contiguity
+		if (layers == 1) {
+			// nothing to do
+		}
+		else if (block.layer == 0) {
+			this->inter_die_boundaries_vert[0].push_back(cur_boundary);
 		}
 		else if (block.layer == layers - 1) {
-			inter_die_boundaries_vert[block.layer - 1].push_back(cur_boundary);
+			this->inter_die_boundaries_vert[block.layer - 1].push_back(cur_boundary);
 		}
 		// layer > 0; block has to be considered for both this and the layer below
 		// in the dedicated data structure
 		else {
-			inter_die_boundaries_vert[block.layer].push_back(cur_boundary);
-			inter_die_boundaries_vert[block.layer - 1].push_back(cur_boundary);
+			this->inter_die_boundaries_vert[block.layer].push_back(cur_boundary);
+			this->inter_die_boundaries_vert[block.layer - 1].push_back(cur_boundary);
 		}
 
 		// right boundary
@@ -196,37 +211,14 @@ void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blo
 					break;
 				}
 
-				// otherwise, some intersection exist;
+				// otherwise, some intersection exist; memorize the pair of
+				// blocks
 				//
 				// (TODO) drop; not required as of now
 //				// determine amount of intersection / common boundary and
 //				// memorize within both blocks
 //				common_boundary_vert = ContiguityAnalysis::common_boundary_vert(b1, b2);
-
-				// init neighbourship storage
-				ContiguityAnalysis::ContiguousNeighbour neighbour_for_b1;
-				ContiguityAnalysis::ContiguousNeighbour neighbour_for_b2;
-				neighbour_for_b1.block = b2.block;
-				neighbour_for_b2.block = b1.block;
-
-				// (TODO) drop; not required as of now
-//				// for b2 being right of b1, the common boundary to be
-//				// stored in b1 is positive and the one for b2 is
-//				// negative
-//				if (b2.block->bb.ll.x > b1.block->bb.ll.x) {
-//					neighbour_for_b1.common_boundary_vert = common_boundary_vert;
-//					neighbour_for_b2.common_boundary_vert = -common_boundary_vert;
-//				}
-//				// b2 is left of b1, store negative value in b1 and
-//				// positive in b2
-//				else {
-//					neighbour_for_b1.common_boundary_vert = -common_boundary_vert;
-//					neighbour_for_b2.common_boundary_vert = common_boundary_vert;
-//				}
-
-				// memorize within each block
-				b1.block->contiguous_neighbours.push_back(neighbour_for_b1);
-				b2.block->contiguous_neighbours.push_back(neighbour_for_b2);
+				this->contiguous_pairs.emplace_back(b1.block, b2.block);
 
 				if (ContiguityAnalysis::DBG) {
 					std::cout << "DBG_CONTIGUITY>   Common boundary with block " << b2.block->id;
@@ -273,37 +265,14 @@ void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blo
 					break;
 				}
 
-				// otherwise, some intersection exist;
+				// otherwise, some intersection exist; memorize the pair of
+				// blocks
 				//
 				// (TODO) drop; not required as of now
 //				// determine amount of intersection / common boundary and
 //				// memorize within both blocks
 //				common_boundary_hor = ContiguityAnalysis::common_boundary_hor(b1, b2);
-
-				// init neighbourship storage
-				ContiguityAnalysis::ContiguousNeighbour neighbour_for_b1;
-				ContiguityAnalysis::ContiguousNeighbour neighbour_for_b2;
-				neighbour_for_b1.block = b2.block;
-				neighbour_for_b2.block = b1.block;
-
-				// (TODO) drop; not required as of now
-//				// for b2 being atop of b1, the common boundary to be
-//				// stored in b1 is positive and the one for b2 is
-//				// negative
-//				if (b2.block->bb.ll.y > b1.block->bb.ll.y) {
-//					neighbour_for_b1.common_boundary_hor = common_boundary_hor;
-//					neighbour_for_b2.common_boundary_hor = -common_boundary_hor;
-//				}
-//				// b2 is below of b1, store negative value in b1 and
-//				// positive in b2
-//				else {
-//					neighbour_for_b1.common_boundary_hor = -common_boundary_hor;
-//					neighbour_for_b2.common_boundary_hor = common_boundary_hor;
-//				}
-
-				// memorize within each block
-				b1.block->contiguous_neighbours.push_back(neighbour_for_b1);
-				b2.block->contiguous_neighbours.push_back(neighbour_for_b2);
+				this->contiguous_pairs.emplace_back(b1.block, b2.block);
 
 				if (ContiguityAnalysis::DBG) {
 					std::cout << "DBG_CONTIGUITY>   Common boundary with block " << b2.block->id;
@@ -330,12 +299,12 @@ void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blo
 		// dimension first (i.e., y for horizontal, and x for vertical boundaries)
 		// and also by their extension dimension; this way, boundaries can next be
 		// easily compared with each other
-		std::sort(inter_die_boundaries_vert[l].begin(), inter_die_boundaries_vert[l].end(), ContiguityAnalysis::boundaries_vert_comp);
+		std::sort(this->inter_die_boundaries_vert[l].begin(), this->inter_die_boundaries_vert[l].end(), ContiguityAnalysis::boundaries_vert_comp);
 
 		if (ContiguityAnalysis::DBG) {
 
 			std::cout << "DBG_CONTIGUITY> Sorted and merged boundaries; dies " << l << " and " << l + 1 << "; left (vertical) boundaries:" << std::endl;
-			for (auto const& boundary : inter_die_boundaries_vert[l]) {
+			for (auto const& boundary : this->inter_die_boundaries_vert[l]) {
 
 				std::cout << "DBG_CONTIGUITY>  Boundary: ";
 				std::cout << "(" << boundary.low.x << "," << boundary.low.y << ")";
@@ -345,6 +314,17 @@ void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blo
 			std::cout << "DBG_CONTIGUITY>" << std::endl;
 		}
 
+		// partition the sorted boundaries by die, still in sorted order; this way,
+		// only the boundaries of the respective other die have to be walked below
+		//
+		// index 0 represents die l, index 1 represents die l + 1
+		this->inter_die_boundaries_vert_partitions[0].clear();
+		this->inter_die_boundaries_vert_partitions[1].clear();
+
+		for (auto const& boundary : this->inter_die_boundaries_vert[l]) {
+			this->inter_die_boundaries_vert_partitions[boundary.block->layer - l].push_back(boundary);
+		}
+
 		// then, walk boundaries and whenever one lower boundary is intersecting
 		// with a block's outline, consider the blocks pair as contiguous
 		// neighbours
@@ -354,12 +334,23 @@ void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blo
 			std::cout << "DBG_CONTIGUITY> Determine intersecting boundaries for dies " << l << " and " << l + 1 << "; derive inter-die contiguity" << std::endl;
 		}
 
+		// sweep-line positions within the partitions, i.e., the count of
+		// boundaries per die which have been passed by the sweep line so far
+		std::array<unsigned, 2> passed = {{0, 0}};
+
 		// walking vertical boundaries; this is sufficient for determining
 		// overlaps in x- and y-dimension
-		for (i1 = inter_die_boundaries_vert[l].begin(); i1 != inter_die_boundaries_vert[l].end(); ++i1) {
+		for (i1 = this->inter_die_boundaries_vert[l].begin(); i1 != this->inter_die_boundaries_vert[l].end(); ++i1) {
 
 			ContiguityAnalysis::Boundary& b1 = (*i1);
 
+			// partition of b1 and of the other die
+			unsigned die_b1 = b1.block->layer - l;
+			std::vector<ContiguityAnalysis::Boundary> const& other_die = this->inter_die_boundaries_vert_partitions[1 - die_b1];
+
+			// b1 is passed now
+			passed[die_b1]++;
+
 			if (ContiguityAnalysis::DBG) {
 				std::cout << "DBG_CONTIGUITY>  Currently considered vertical segment ";
 				std::cout << "(" << b1.low.x << "," << b1.low.y << ")";
@@ -367,13 +358,12 @@ void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blo
 			}
 
 			// the boundary b2, to be compared to b1, should be within the
-			// x-range of b1.block; thus, we start from the next element (not
-			// the same, in order to avoid comparison with itself) in the set
-			// of sorted boundaries
-			i2 = i1 + 1;
-			for (; i2 != inter_die_boundaries_vert[l].end(); ++i2) {
+			// x-range of b1.block, and it should be from the other die; thus, we
+			// start from the first not yet passed element of the other die's
+			// sorted boundaries
+			for (unsigned b = passed[1 - die_b1]; b < other_die.size(); b++) {
 
-				ContiguityAnalysis::Boundary& b2 = (*i2);
+				ContiguityAnalysis::Boundary const& b2 = other_die[b];
 
 				// break condition; if b2 is outside of b1 (to the right
 				// of b1.block), no intersection if feasible anymore
@@ -381,12 +371,10 @@ void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blo
 					break;
 				}
 
-				// otherwise, some intersection _may_ exist, but only a)
-				// for blocks of the other die and b) if there is some
-				// overlap in y-direction
-				if ((b2.block->layer != b1.block->layer) &&
-						(b1.low.y <= b2.high.y && b2.low.y <= b1.high.y)
-				   ) {
+				// otherwise, some intersection _may_ exist, but only if there
+				// is some overlap in y-direction
+				if (b1.low.y <= b2.high.y && b2.low.y <= b1.high.y) {
+
 					// at this point, we know that b2 is intersecting
 					// with b1 to some degree in _both_ dimensions;
 					// thus, we can simplify the inter-die contiguity
@@ -401,53 +389,11 @@ void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blo
 //					// thus we have to extract the horizontal common
 //					// boundary from the blocks themselves
 //					common_boundary_hor = ContiguityAnalysis::common_boundary_hor(b1.block, b2.block);
-
-					// init neighbourship storage
-					ContiguityAnalysis::ContiguousNeighbour neighbour_for_b1;
-					ContiguityAnalysis::ContiguousNeighbour neighbour_for_b2;
-					neighbour_for_b1.block = b2.block;
-					neighbour_for_b2.block = b1.block;
-
-					// (TODO) drop; not required as of now
-//					// for b2 being right of b1, the common boundary to be
-//					// stored in b1 is positive and the one for b2 is
-//					// negative
-//					if (b2.block->bb.ll.x > b1.block->bb.ll.x) {
-//						neighbour_for_b1.common_boundary_inter_die_vert = common_boundary_vert;
-//						neighbour_for_b2.common_boundary_inter_die_vert = -common_boundary_vert;
-//					}
-//					// b2 is left of b1, store negative value in b1 and
-//					// positive in b2
-//					else {
-//						neighbour_for_b1.common_boundary_inter_die_vert = -common_boundary_vert;
-//						neighbour_for_b2.common_boundary_inter_die_vert = common_boundary_vert;
-//					}
-//
-//					// for b2 being atop of b1, the common boundary to
-//					// be stored in b1 is positive and the one for b2
-//					// is negative
-//					if (b2.block->bb.ll.y > b1.block->bb.ll.y) {
-//						neighbour_for_b1.common_boundary_inter_die_hor = common_boundary_hor;
-//						neighbour_for_b2.common_boundary_inter_die_hor = -common_boundary_hor;
-//					}
-//					// b2 is below of b1, store negative value in b1
-//					// and positive in b2
-//					else {
-//						neighbour_for_b1.common_boundary_inter_die_hor = -common_boundary_hor;
-//						neighbour_for_b2.common_boundary_inter_die_hor = common_boundary_hor;
-//					}
-
-					// memorize within each block
-					b1.block->contiguous_neighbours.push_back(neighbour_for_b1);
-					b2.block->contiguous_neighbours.push_back(neighbour_for_b2);
+					this->contiguous_pairs.emplace_back(b1.block, b2.block);
 
 					if (ContiguityAnalysis::DBG) {
 						std::cout << "DBG_CONTIGUITY>   2-dimensional contiguity with block " << b2.block->id;
 						std::cout << "; die " << b2.block->layer << ":";
-						// (TODO) drop; not required as of now
-//						std::cout << " (" << neighbour_for_b1.common_boundary_inter_die_hor;
-//						std::cout << ", " << neighbour_for_b1.common_boundary_inter_die_vert;
-//						std::cout << ");";
 						std::cout << " dimensions of related intersection box:";
 						Rect bb = Rect::determineIntersection(b1.block->bb, b2.block->bb);
 						std::cout << " (" << bb.w;
@@ -463,6 +409,9 @@ void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blo
 		}
 	}
 
+	// finally, derive the flat adjacency array
+	this->buildNeighbours(blocks);
+
 	if (ContiguityAnalysis::DBG) {
 		std::cout << "DBG_CONTIGUITY> Contiguous neighbours for all blocks:" << std::endl;
 
@@ -470,14 +419,8 @@ void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blo
 
 			std::cout << "DBG_CONTIGUITY>  Block " << block.id << ":" << std::endl;
 
-			for (auto& neighbour : block.contiguous_neighbours) {
+			for (auto& neighbour : this->contiguousNeighbours(block)) {
 				std::cout << "DBG_CONTIGUITY>   " << neighbour.block->id;
-				// (TODO) drop; not required as of now
-//				std::cout << " (" << neighbour.common_boundary_hor;
-//				std::cout << ", " << neighbour.common_boundary_vert;
-//				std::cout << ", " << neighbour.common_boundary_inter_die_hor;
-//				std::cout << ", " << neighbour.common_boundary_inter_die_vert;
-//				std::cout << ")";
 				std::cout << std::endl;
 			}
 		}
@@ -486,6 +429,86 @@ void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blo
 	}
 }
 
+/// the flat adjacency array is derived via counting sort from the contiguous pairs;
+/// for each block, the order of its neighbours follows the order of determination
+void ContiguityAnalysis::buildNeighbours(std::vector<Block> const& blocks) {
+	unsigned n;
+
+	// reset offsets; account for one additional entry, representing the end of the
+	// range for the last block
+	this->neighbours_offset.assign(blocks.size() + 1, 0);
+
+	// count neighbours for each block; counts are stored shifted by one, for
+	// subsequent prefix sum
+	for (auto const& pair : this->contiguous_pairs) {
+		this->neighbours_offset[pair.first->numerical_id + 1]++;
+		this->neighbours_offset[pair.second->numerical_id + 1]++;
+	}
+
+	// prefix sum; derives the offsets
+	for (n = 1; n < this->neighbours_offset.size(); n++) {
+		this->neighbours_offset[n] += this->neighbours_offset[n - 1];
+	}
+
+	// fill adjacency array; the offsets are used as insertion positions here, and
+	// they are restored afterwards
+	this->neighbours.resize(this->neighbours_offset.back());
+
+	for (auto const& pair : this->contiguous_pairs) {
+		this->neighbours[this->neighbours_offset[pair.first->numerical_id]++].block = pair.second;
+		this->neighbours[this->neighbours_offset[pair.second->numerical_id]++].block = pair.first;
+	}
+
+	// restore offsets; after filling, each offset points to the begin of the next
+	// block's range
+	for (n = this->neighbours_offset.size() - 1; n > 0; n--) {
+		this->neighbours_offset[n] = this->neighbours_offset[n - 1];
+	}
+	this->neighbours_offset[0] = 0;
+}
+
+ContiguityAnalysis::Neighbours ContiguityAnalysis::contiguousNeighbours(Block const& block) {
+	ContiguityAnalysis::Neighbours ret;
+
+	ret.first = this->neighbours.data() + this->neighbours_offset[block.numerical_id];
+	ret.last = this->neighbours.data() + this->neighbours_offset[block.numerical_id + 1];
+
+	return ret;
+}
+
+bool ContiguityAnalysis::placementChanged(int const& layers, std::vector<Block> const& blocks) {
+	bool changed;
+
+	// different set of blocks, or different stack; consider as changed
+	changed = (this->prev_blocks != blocks.data()) ||
+		(this->prev_placement.size() != blocks.size()) ||
+		(static_cast<int>(this->boundaries_vert.size()) != layers);
+
+	this->prev_blocks = blocks.data();
+	this->prev_placement.resize(blocks.size());
+
+	// compare and memorize blocks' placement
+	for (unsigned b = 0; b < blocks.size(); b++) {
+
+		ContiguityAnalysis::PlacedBlock& prev = this->prev_placement[b];
+		Block const& block = blocks[b];
+
+		if (!changed && (
+				prev.layer != block.layer ||
+				prev.ll.x != block.bb.ll.x || prev.ll.y != block.bb.ll.y ||
+				prev.ur.x != block.bb.ur.x || prev.ur.y != block.bb.ur.y
+			)) {
+			changed = true;
+		}
+
+		prev.layer = block.layer;
+		prev.ll = block.bb.ll;
+		prev.ur = block.bb.ur;
+	}
+
+	return changed;
+}
+
 /// helper to check vertical boundaries
 inline bool ContiguityAnalysis::boundaries_vert_comp(ContiguityAnalysis::Boundary const& b1, ContiguityAnalysis::Boundary const& b2) {
 	return (
@@ -86,11 +86,73 @@ class ContiguityAnalysis {
 		/// MultipleVoltages::CompoundModule::updateOutlineCost); thus the data is public
 		std::vector< std::vector<ContiguityAnalysis::Boundary> > boundaries_vert;
 
+		/// range of contiguous neighbours for one block; may be walked w/
+		/// range-based for loops
+		struct Neighbours {
+
+			ContiguousNeighbour* first;
+			ContiguousNeighbour* last;
+
+			inline ContiguousNeighbour* begin() const {
+				return this->first;
+			}
+			inline ContiguousNeighbour* end() const {
+				return this->last;
+			}
+			inline unsigned size() const {
+				return this->last - this->first;
+			}
+		};
+
 	// private data, functions
 	private:
+		/// POD for memorizing blocks' placement of the previous analysis
+		struct PlacedBlock {
+
+			int layer;
+
+			Point ll;
+			Point ur;
+		};
+
+		/// this data structure is used for inter-die contiguity analysis; it
+		/// comprises the left boundaries of blocks on the dies l and l + 1; note
+		/// that considering / walking one dimension's boundaries is sufficient to
+		/// determine intersections in both dimensions / overlaps
+		std::vector< std::vector<ContiguityAnalysis::Boundary> > inter_die_boundaries_vert;
+		/// partitions of the inter-die boundaries for one pair of adjacent dies,
+		/// separated by die, but still in sorted order
+		std::array< std::vector<ContiguityAnalysis::Boundary>, 2> inter_die_boundaries_vert_partitions;
+
+		/// flat list of contiguous pairs of blocks, in order of their
+		/// determination
+		std::vector< std::pair<Block const*, Block const*> > contiguous_pairs;
+
+		/// flat adjacency array of contiguous neighbours; the neighbours of the
+		/// block w/ numerical id n are found in the range [neighbours_offset[n],
+		/// neighbours_offset[n + 1])
+		std::vector<ContiguousNeighbour> neighbours;
+		/// flat adjacency array, offsets for each block
+		std::vector<unsigned> neighbours_offset;
+
+		/// placement of blocks as considered during the previous analysis; if
+		/// the placement is unchanged, the analysis is skipped
+		std::vector<ContiguityAnalysis::PlacedBlock> prev_placement;
+		/// blocks considered during the previous analysis
+		Block const* prev_blocks = nullptr;
+
+		/// note that all the data structures above are kept across calls, such
+		/// that their capacity is reused and no further allocations are required
+
 		inline static bool boundaries_vert_comp(Boundary const& b1, Boundary const& b2);
 		inline static bool boundaries_hor_comp(Boundary const& b1, Boundary const& b2);
 
+		/// helper to check whether the placement of blocks has changed since the
+		/// previous analysis; also memorizes the current placement
+		bool placementChanged(int const& layers, std::vector<Block> const& blocks);
+		/// helper to derive the flat adjacency array from the contiguous pairs
+		void buildNeighbours(std::vector<Block> const& blocks);
+
 		// (TODO) drop; not required as of now
 //		inline static double common_boundary_vert(Boundary const& b1, Boundary const& b2);
 //		inline static double common_boundary_hor(Boundary const& b1, Boundary const& b2);
@@ -102,6 +164,10 @@ class ContiguityAnalysis {
 	// public data, functions
 	public:
 		void analyseBlocks(int layers, std::vector<Block> const& blocks);
+
+		/// getter for contiguous neighbours of a block; only valid until the
+		/// next call of analyseBlocks
+		Neighbours contiguousNeighbours(Block const& block);
 };
 
 #endif
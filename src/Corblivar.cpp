@@ -25,6 +25,8 @@
 #include "CorblivarCore.hpp"
 #include "FloorPlanner.hpp"
 #include "IO.hpp"
+#include "BatchRunner.hpp"
+#include "DistributedSA.hpp"
 
 int main (int argc, char** argv) {
 	FloorPlanner fp;
@@ -34,6 +36,23 @@ int main (int argc, char** argv) {
 	std::cout << "Corblivar: Corner Block List for Varied [Block] Alignment Requests" << std::endl;
 	std::cout << "----- 3D floorplanning tool v 1.4.4 ------------------------------" << std::endl << std::endl;
 
+	// batch mode; all jobs are handled by the batch runner
+	if (argc > 1 && std::string(argv[1]) == "--batch") {
+		BatchRunner::run(argc, argv);
+		return 0;
+	}
+
+	// distributed SA; coordinator mode, no floorplanning
+	if (argc > 1 && std::string(argv[1]) == "--coordinator") {
+		DistributedSA::runCoordinator(argc, argv);
+		return 0;
+	}
+	// distributed SA; worker mode, the remaining parameters are handled as for
+	// regular runs
+	if (argc > 1 && std::string(argv[1]) == "--worker") {
+		DistributedSA::initWorker(fp, argc, argv);
+	}
+
 	// parse program parameter, config file, and further files
 	IO::parseParametersFiles(fp, argc, argv);
 	// parse blocks
@@ -76,12 +95,22 @@ int main (int argc, char** argv) {
 	}
 	// regular run; perform floorplanning
 	else {
-		// generate new, random data set
-		corb.initCorblivarRandomly(fp.logMed(), fp.getLayers(), fp.getBlocks(), fp.powerAwareBlockHandling());
+		// resume from checkpoint; data set is restored during SA
+		if (fp.resumeFromCheckpoint()) {
 
-		if (fp.logMin()) {
-			std::cout << "Corblivar> ";
-			std::cout << "Performing SA floorplanning optimization ..." << std::endl << std::endl;
+			if (fp.logMin()) {
+				std::cout << "Corblivar> ";
+				std::cout << "Resuming SA floorplanning optimization from checkpoint ..." << std::endl << std::endl;
+			}
+		}
+		else {
+			// generate new, random data set
+			corb.initCorblivarRandomly(fp.logMed(), fp.getLayers(), fp.getBlocks(), fp.powerAwareBlockHandling());
+
+			if (fp.logMin()) {
+				std::cout << "Corblivar> ";
+				std::cout << "Performing SA floorplanning optimization ..." << std::endl << std::endl;
+			}
 		}
 
 		// perform SA; main handler
@@ -38,13 +38,18 @@
 #include <bitset>
 #include <utility>
 #include <algorithm>
-// (TODO) replace w/ chrono
-#include <sys/timeb.h>
+#include <limits>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <chrono>
 
 // C libaries
 // (TODO) replace w/ STL where possible
 #include <ctime>
 #include <cmath>
 #include <cstdlib>
+#include <cstdio>
 
 #endif
@@ -81,8 +81,9 @@ void CorblivarCore::initCorblivarRandomly(bool const& log, int const& layers, st
 	// copy of blocks container
 	for (Block& cur_block_copy : blocks_copy) {
 
-		// determine related block from original blocks container
-		cur_block = Block::findBlock(cur_block_copy.id, blocks);
+		// determine related block from original blocks container; the numerical
+		// ids of blocks are equal to their indices in the container
+		cur_block = &blocks[cur_block_copy.numerical_id];
 
 		// for power-aware assignment, fill layers w/ (sorted) blocks until the
 		// dies are evenly occupied
@@ -161,6 +162,12 @@ bool CorblivarCore::generateLayout(bool const& perform_alignment) {
 	// reset alignments-in-process list
 	AL.clear();
 
+	// build index of alignment requests; only required once after requests are
+	// parsed/edited
+	if (perform_alignment && !this->A_blocks_valid) {
+		this->initAlignmentReqsIndex();
+	}
+
 	if (CorblivarAlignmentReq::DBG_LAYOUT_GENERATION) {
 		std::cout << "DBG_ALIGNMENT>" << std::endl;
 		std::cout << "DBG_ALIGNMENT> New layout-generation run..." << std::endl;
@@ -215,7 +222,7 @@ bool CorblivarCore::generateLayout(bool const& perform_alignment) {
 			if (perform_alignment) {
 
 				// determine related requests for current block
-				cur_block_alignment_reqs = this->findAlignmentReqs(cur_block);
+				this->findAlignmentReqs(cur_block, cur_block_alignment_reqs);
 
 				// some requests are given, handle them stepwise
 				if (!cur_block_alignment_reqs.empty()) {
@@ -745,49 +752,67 @@ void CorblivarCore::sequentialShiftingHelper(CorblivarDie* die_b1, CorblivarDie*
 	}
 }
 
-std::vector<CorblivarAlignmentReq const*> CorblivarCore::findAlignmentReqs(Block const* b) const {
-	std::vector<CorblivarAlignmentReq const*> ret;
+void CorblivarCore::initAlignmentReqsIndex() {
 
-	// sanity check for no given requests
-	if (this->A.empty()) {
-		return ret;
-	}
+	this->A_blocks.clear();
 
-	// determine requests covering the given block
 	for (CorblivarAlignmentReq const& req : this->A) {
 
-		if (req.s_i->numerical_id == b->numerical_id || req.s_j->numerical_id == b->numerical_id) {
-
-			// only consider request which are still in
-			// process, i.e., not both blocks are placed yet
-			if (!req.s_i->placed || !req.s_j->placed) {
+		// memorize request for both blocks; RBOD is not considered since it is
+		// never handled as current block during layout generation
+		for (Block const* b : {req.s_i, req.s_j}) {
 
-				if (CorblivarAlignmentReq::DBG_LAYOUT_GENERATION) {
-					std::cout << "DBG_ALIGNMENT>  Unhandled request: " << req.tupleString() << std::endl;
-				}
+			if (b->numerical_id == RBOD::NUMERICAL_ID) {
+				continue;
+			}
 
-				ret.push_back(&req);
+			if (this->A_blocks.size() <= static_cast<unsigned>(b->numerical_id)) {
+				this->A_blocks.resize(b->numerical_id + 1);
 			}
+
+			this->A_blocks[b->numerical_id].push_back(&req);
 		}
 	}
 
+	this->A_blocks_valid = true;
+}
+
+void CorblivarCore::findAlignmentReqs(Block const* b, std::vector<CorblivarAlignmentReq const*>& ret) const {
+
+	ret.clear();
+
+	// sanity check for blocks w/o any requests
+	if (static_cast<unsigned>(b->numerical_id) >= this->A_blocks.size()) {
+		return;
+	}
+
+	std::vector<CorblivarAlignmentReq const*> const& reqs = this->A_blocks[b->numerical_id];
+
 	// requests w/ placed blocks are considered first; eases handling
 	// of alignment requests such that blocks ready for alignment are
 	// placed/aligned first
-	std::sort(ret.begin(), ret.end(),
-		// lambda expression
-		[](CorblivarAlignmentReq const* req1, CorblivarAlignmentReq const* req2) {
-			return
-				// std::sort requires a _strict_ ordering, thus we have to make sure that same elements returns false
-				// http://stackoverflow.com/a/1541909
-				// also helps to make comparison short-cutting it early
-				(req1 != req2) && (
-					(req1->s_i->placed || req1->s_j->placed) && (!req2->s_i->placed && !req2->s_j->placed)
-				);
+	//
+	// only consider request which are still in process, i.e., not both blocks are
+	// placed yet
+	for (CorblivarAlignmentReq const* req : reqs) {
+
+		if ((req->s_i->placed || req->s_j->placed) && !(req->s_i->placed && req->s_j->placed)) {
+			ret.push_back(req);
 		}
-	);
+	}
+	// requests w/o placed blocks are considered afterwards
+	for (CorblivarAlignmentReq const* req : reqs) {
 
-	return ret;
+		if (!req->s_i->placed && !req->s_j->placed) {
+			ret.push_back(req);
+		}
+	}
+
+	if (CorblivarAlignmentReq::DBG_LAYOUT_GENERATION) {
+		for (CorblivarAlignmentReq const* req : ret) {
+			std::cout << "DBG_ALIGNMENT>  Unhandled request: " << req->tupleString() << std::endl;
+		}
+	}
 }
 
 void CorblivarCore::sortCBLs(bool const& log, int const& mode) {
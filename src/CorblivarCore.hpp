@@ -76,6 +76,13 @@ class CorblivarCore {
 		/// alignments-in-process list
 		std::list<CorblivarAlignmentReq const*> AL;
 
+		/// index of alignment requests; for each block (given by numerical id), all requests covering that block, in the same order as in sequence A
+		std::vector< std::vector<CorblivarAlignmentReq const*> > A_blocks;
+		/// flag whether index of alignment requests is up-to-date w/ sequence A; to be reset whenever A is edited
+		bool A_blocks_valid = false;
+		/// helper to (re-)build index of alignment requests
+		void initAlignmentReqsIndex();
+
 		/// handler for block alignment
 		bool alignBlocks(CorblivarAlignmentReq const* req);
 		/// handler for block alignment
@@ -85,8 +92,8 @@ class CorblivarCore {
 				std::list<Block const*> b1_relev_blocks, std::list<Block const*> b2_relev_blocks,
 				Direction const& dir_b1,
 				bool& b1_shifted, bool& b2_shifted);
-		/// handler for block alignment
-		std::vector<CorblivarAlignmentReq const*> findAlignmentReqs(Block const* b) const;
+		/// handler for block alignment; requests are put into ret, which is cleared beforehand
+		void findAlignmentReqs(Block const* b, std::vector<CorblivarAlignmentReq const*>& ret) const;
 
 	// constructors, destructors, if any non-implicit
 	public:
@@ -122,8 +129,10 @@ class CorblivarCore {
 		inline CorblivarDie const& getDie(unsigned const& die) const {
 			return this->dies[die];
 		};
-		/// setter
+		/// setter; note that the index of requests has to be rebuilt afterwards
 		inline std::vector<CorblivarAlignmentReq>& editAlignments() {
+			this->A_blocks_valid = false;
+
 			return this->A;
 		};
 		/// getter
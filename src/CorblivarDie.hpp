@@ -117,6 +117,8 @@ class CorblivarDie {
 	// public data, functions
 	public:
 		friend class CorblivarCore;
+		friend class IO;
+		friend class Multilevel;
 
 		/// setter
 		inline CornerBlockList& editCBL() {
@@ -144,6 +146,10 @@ class CorblivarDie {
 			return this->CBL.L[this->pi];
 		};
 		/// getter
+		inline Direction const& getDirection(unsigned const& tuple) const {
+			return this->CBL.L[tuple];
+		};
+		/// getter
 		inline unsigned const& getJunctions(unsigned const& tuple) const {
 			return this->CBL.T[tuple];
 		};
@@ -52,6 +52,8 @@ class CornerBlockList {
 	public:
 		friend class CorblivarCore;
 		friend class CorblivarDie;
+		friend class IO;
+		friend class Multilevel;
 
 		/// POD; wrapper for tuples of separate sequences
 		struct Tuple {
@@ -0,0 +1,384 @@
+/**
+ * =====================================================================================
+ *
+ *    Description:  Corblivar distributed SA; coordinator and worker handling for
+ *    annealing chains spread across processes
+ *
+ *    Copyright (C) 2013-2016 Johann Knechtel, johann aett jknechtel dot de
+ *
+ *    This file is part of Corblivar.
+ *
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// own Corblivar header
+#include "DistributedSA.hpp"
+// required Corblivar headers
+#include "FloorPlanner.hpp"
+#include "Math.hpp"
+// required library headers
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cerrno>
+
+void DistributedSA::runCoordinator(int const& argc, char** argv) {
+	int port;
+	unsigned workers, next_id, done;
+	std::string solution_file;
+	int server, client, opt;
+	sockaddr_in addr;
+	std::vector<pollfd> fds;
+	std::vector<unsigned> ids;
+	double best_cost;
+	std::string best_solution;
+	unsigned best_worker;
+	DistributedSA::Message msg, reply;
+	std::ofstream out;
+
+	if (argc < 4) {
+		std::cout << "Distributed> Usage: " << argv[0] << " --coordinator port workers [solution_file]" << std::endl;
+		std::cout << "Distributed> " << std::endl;
+		std::cout << "Distributed> Mandatory parameter ``port'': TCP port on the loopback interface" << std::endl;
+		std::cout << "Distributed> Mandatory parameter ``workers'': count of workers, to be started as ``" << argv[0] << " --worker port benchmark_name ...''" << std::endl;
+		std::cout << "Distributed> Optional parameter ``solution_file'': file for the global best solution" << std::endl;
+		exit(1);
+	}
+
+	port = atoi(argv[2]);
+	workers = atoi(argv[3]);
+	if (argc > 4) {
+		solution_file = argv[4];
+	}
+
+	if (port <= 0 || workers == 0) {
+		std::cout << "Distributed> Invalid port or count of workers: " << argv[2] << " " << argv[3] << std::endl;
+		exit(1);
+	}
+
+	// listen on loopback interface
+	server = socket(AF_INET, SOCK_STREAM, 0);
+	opt = 1;
+	setsockopt(server, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
+
+	addr = sockaddr_in();
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(port);
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+	if (server < 0 || bind(server, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || listen(server, workers) != 0) {
+		std::cout << "Distributed> Cannot listen on port " << port << std::endl;
+		exit(1);
+	}
+
+	std::cout << "Distributed> Coordinator listening on 127.0.0.1:" << port << " for " << workers << " workers ..." << std::endl;
+
+	// the server socket is always the first one to poll
+	fds.push_back({server, POLLIN, 0});
+	ids.push_back(0);
+
+	next_id = done = 0;
+	best_cost = std::numeric_limits<double>::max();
+	best_worker = 0;
+
+	while (done < workers) {
+
+		if (poll(fds.data(), fds.size(), -1) < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			std::cout << "Distributed> Polling of connections failed" << std::endl;
+			exit(1);
+		}
+
+		// handle messages of workers; reverse order, for erasing of closed
+		// connections
+		for (unsigned i = fds.size() - 1; i > 0; i--) {
+
+			if (fds[i].revents == 0) {
+				continue;
+			}
+
+			if (!DistributedSA::receive(fds[i].fd, msg)) {
+				std::cout << "Distributed> Connection to worker " << ids[i] << " lost" << std::endl;
+				msg.type = "LOST";
+			}
+
+			if (DistributedSA::DBG) {
+				std::cout << "DBG_DISTRIBUTED> Worker " << ids[i] << ": " << msg.type << " " << msg.cost << " " << msg.solution.size() << std::endl;
+			}
+
+			if (msg.type == "HELLO") {
+				reply.type = "WORKER";
+				reply.cost = ids[i];
+				reply.solution.clear();
+				DistributedSA::send(fds[i].fd, reply);
+
+				continue;
+			}
+
+			// memorize global best solution
+			if ((msg.type == "BEST" || msg.type == "DONE") && !msg.solution.empty() && msg.cost < best_cost) {
+				best_cost = msg.cost;
+				best_solution = std::move(msg.solution);
+				best_worker = ids[i];
+
+				std::cout << "Distributed> New global best solution from worker " << best_worker << "; cost: " << best_cost << std::endl;
+			}
+
+			// reply w/ global best solution, unless it's the worker's own one
+			if (msg.type == "BEST") {
+
+				if (!best_solution.empty() && best_worker != ids[i]) {
+					reply.type = "BEST";
+					reply.cost = best_cost;
+					reply.solution = best_solution;
+				}
+				else {
+					reply.type = "NONE";
+					reply.solution.clear();
+				}
+				DistributedSA::send(fds[i].fd, reply);
+			}
+			// worker done, or lost
+			else {
+				std::cout << "Distributed> Worker " << ids[i] << " done" << std::endl;
+
+				close(fds[i].fd);
+				fds.erase(fds.begin() + i);
+				ids.erase(ids.begin() + i);
+				done++;
+			}
+		}
+
+		// new connections
+		if (fds[0].revents & POLLIN) {
+
+			client = accept(server, nullptr, nullptr);
+
+			if (client >= 0) {
+				// only the defined count of workers is served
+				if (next_id < workers) {
+					fds.push_back({client, POLLIN, 0});
+					ids.push_back(next_id);
+
+					std::cout << "Distributed> Worker " << next_id << " connected" << std::endl;
+
+					next_id++;
+				}
+				else {
+					close(client);
+				}
+			}
+		}
+	}
+
+	close(server);
+
+	if (best_solution.empty()) {
+		std::cout << "Distributed> Done; no solution available" << std::endl;
+		return;
+	}
+
+	std::cout << "Distributed> Done; global best solution from worker " << best_worker << "; cost: " << best_cost << std::endl;
+
+	if (!solution_file.empty()) {
+		out.open(solution_file.c_str());
+		out << best_solution;
+		out.close();
+
+		std::cout << "Distributed> Global best solution written into " << solution_file << std::endl;
+	}
+}
+
+void DistributedSA::initWorker(FloorPlanner& fp, int& argc, char**& argv) {
+	int port;
+	sockaddr_in addr;
+	DistributedSA::Message msg;
+	unsigned id;
+
+	if (argc < 3) {
+		std::cout << "Distributed> Usage: " << argv[0] << " --worker port benchmark_name config_file benchmarks_dir [solution_file] [TSV_density]" << std::endl;
+		exit(1);
+	}
+
+	port = atoi(argv[2]);
+
+	addr = sockaddr_in();
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(port);
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+	fp.coordinator_socket = socket(AF_INET, SOCK_STREAM, 0);
+
+	if (fp.coordinator_socket < 0 || connect(fp.coordinator_socket, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+		std::cout << "Distributed> Cannot connect to coordinator on port " << argv[2] << std::endl;
+		exit(1);
+	}
+
+	// retrieve worker id
+	msg.type = "HELLO";
+	msg.cost = 0.0;
+	if (!DistributedSA::send(fp.coordinator_socket, msg) || !DistributedSA::receive(fp.coordinator_socket, msg) || msg.type != "WORKER") {
+		std::cout << "Distributed> Coordinator on port " << argv[2] << " not responding" << std::endl;
+		exit(1);
+	}
+	id = static_cast<unsigned>(msg.cost);
+
+	// workers started at the same time must not follow the same sequence of
+	// random numbers
+	Math::seedRand(time(0) + id);
+
+	// separate output dir for each worker
+	fp.IO_conf.output_dir = "worker" + std::to_string(id) + "/";
+	mkdir(fp.IO_conf.output_dir.c_str(), 0755);
+
+	std::cout << "Distributed> Connected to coordinator as worker " << id << "; output dir: " << fp.IO_conf.output_dir << std::endl << std::endl;
+
+	// remove worker parameters; retain program name
+	argv[2] = argv[0];
+	argv += 2;
+	argc -= 2;
+}
+
+bool DistributedSA::exchange(int& socket, double const& cost, std::string const& solution, double& global_cost, std::string& global_solution) {
+	DistributedSA::Message msg;
+
+	msg.type = "BEST";
+	msg.cost = cost;
+	msg.solution = solution;
+
+	if (!DistributedSA::send(socket, msg) || !DistributedSA::receive(socket, msg)) {
+		std::cout << "Distributed> Connection to coordinator lost; continue w/o exchange" << std::endl;
+
+		close(socket);
+		socket = -1;
+
+		return false;
+	}
+
+	if (msg.type != "BEST") {
+		return false;
+	}
+
+	global_cost = msg.cost;
+	global_solution = std::move(msg.solution);
+
+	return true;
+}
+
+void DistributedSA::finish(int& socket, double const& cost, std::string const& solution) {
+	DistributedSA::Message msg;
+
+	msg.type = "DONE";
+	msg.cost = cost;
+	msg.solution = solution;
+
+	DistributedSA::send(socket, msg);
+
+	close(socket);
+	socket = -1;
+}
+
+bool DistributedSA::send(int const& socket, DistributedSA::Message const& msg) {
+	std::stringstream header;
+	std::string data;
+	size_t sent;
+	ssize_t ret;
+
+	header << msg.type;
+	if (msg.type != "HELLO" && msg.type != "NONE") {
+		header << " " << std::setprecision(std::numeric_limits<double>::max_digits10) << msg.cost;
+	}
+	if (msg.type == "BEST" || msg.type == "DONE") {
+		header << " " << msg.solution.size();
+	}
+	header << "\n";
+
+	data = header.str() + msg.solution;
+
+	// the whole message is sent; avoid SIGPIPE for lost connections
+	sent = 0;
+	while (sent < data.size()) {
+
+		ret = ::send(socket, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+		if (ret < 0 && errno == EINTR) {
+			continue;
+		}
+		else if (ret <= 0) {
+			return false;
+		}
+
+		sent += ret;
+	}
+
+	return true;
+}
+
+bool DistributedSA::receive(int const& socket, DistributedSA::Message& msg) {
+	std::string line;
+	std::stringstream header;
+	size_t bytes, received;
+	ssize_t ret;
+	char c;
+
+	// header line; read char-wise, in order to not consume the solution
+	while (true) {
+
+		ret = recv(socket, &c, 1, 0);
+		if (ret < 0 && errno == EINTR) {
+			continue;
+		}
+		else if (ret <= 0) {
+			return false;
+		}
+
+		if (c == '\n') {
+			break;
+		}
+		line += c;
+	}
+
+	header.str(line);
+	header >> msg.type;
+	msg.cost = 0.0;
+	bytes = 0;
+	if (msg.type != "HELLO" && msg.type != "NONE") {
+		header >> msg.cost;
+	}
+	if (msg.type == "BEST" || msg.type == "DONE") {
+		header >> bytes;
+	}
+
+	// solution, if any
+	msg.solution.resize(bytes);
+	received = 0;
+	while (received < bytes) {
+
+		ret = recv(socket, &msg.solution[received], bytes - received, 0);
+		if (ret < 0 && errno == EINTR) {
+			continue;
+		}
+		else if (ret <= 0) {
+			return false;
+		}
+
+		received += ret;
+	}
+
+	return true;
+}
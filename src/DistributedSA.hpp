@@ -0,0 +1,103 @@
+/**
+ * =====================================================================================
+ *
+ *    Description:  Corblivar distributed SA; coordinator and worker handling for
+ *    annealing chains spread across processes
+ *
+ *    Copyright (C) 2013-2016 Johann Knechtel, johann aett jknechtel dot de
+ *
+ *    This file is part of Corblivar.
+ *
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_DISTRIBUTED_SA
+#define _CORBLIVAR_DISTRIBUTED_SA
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+// forward declarations, if any
+class FloorPlanner;
+
+/// Corblivar distributed SA
+///
+/// several Corblivar processes, the workers, perform their SA runs independently; every
+/// FloorPlanner::SA_DISTRIBUTED_EXCHANGE_INTERVAL temperature steps in SA phase two,
+/// each worker sends its best solution and cost to the coordinator, and receives the
+/// global best solution in return; the worker adopts that solution as its best and as
+/// starting point for the further annealing, but only if the solution is better than
+/// its own best solution for its own cost function
+///
+/// the protocol is based on TCP connections over the loopback interface; all messages
+/// are one header line, optionally followed by a solution in the format of
+/// CorblivarCore::CBLsString:
+///  worker -> coordinator: ``HELLO''; coordinator -> worker: ``WORKER id''
+///  worker -> coordinator: ``BEST cost bytes'' and solution; coordinator -> worker:
+///   ``BEST cost bytes'' and global best solution, or ``NONE'' if the global best
+///   solution is the worker's own solution
+///  worker -> coordinator: ``DONE cost bytes'' and final best solution; no reply
+///
+/// note that the cost values are normalized by each worker separately, see
+/// FloorPlanner::evaluateLayout; the global best solution is thus only an estimate,
+/// the final decision is made by the workers
+class DistributedSA {
+	private:
+		/// debugging code switch (private)
+		static constexpr bool DBG = false;
+
+	// private data, functions
+	private:
+		/// POD for messages
+		struct Message {
+			std::string type;
+			/// cost, or worker id for WORKER messages
+			double cost;
+			std::string solution;
+		};
+
+		/// send message; returns false if the connection is lost
+		static bool send(int const& socket, Message const& msg);
+		/// receive message; returns false if the connection is lost
+		static bool receive(int const& socket, Message& msg);
+
+	// constructors, destructors, if any non-implicit
+	private:
+		/// empty default constructor; private in order to avoid instances of ``static'' class
+		DistributedSA() {
+		}
+
+	// public data, functions
+	public:
+		/// coordinator handler; call as ``Corblivar --coordinator port workers
+		/// [solution_file]''; the global best solution is written into the solution
+		/// file, if given
+		static void runCoordinator(int const& argc, char** argv);
+
+		/// worker handler; call as ``Corblivar --worker port benchmark_name ...'',
+		/// i.e., w/ the regular parameters following; connects to the coordinator,
+		/// applies the worker id to the random-number generator and to the output
+		/// dir ``workerID/'', and removes the worker parameters from argc and argv
+		static void initWorker(FloorPlanner& fp, int& argc, char**& argv);
+
+		/// worker handler; exchanges the best solution w/ the coordinator; returns
+		/// true if a global best solution is received; if the connection is lost,
+		/// the socket is closed and reset to -1
+		static bool exchange(int& socket, double const& cost, std::string const& solution, double& global_cost, std::string& global_solution);
+
+		/// worker handler; sends the final best solution, closes the connection
+		/// and resets the socket to -1
+		static void finish(int& socket, double const& cost, std::string const& solution);
+};
+
+#endif
@@ -33,6 +33,9 @@
 #include "Clustering.hpp"
 #include "ContiguityAnalysis.hpp"
 #include "MultipleVoltages.hpp"
+#include "BatchRunner.hpp"
+#include "DistributedSA.hpp"
+#include "Multilevel.hpp"
 
 
 /// memory allocation
@@ -47,7 +50,12 @@ constexpr double TSV_Island::AR_MAX;
 /// main handler
 bool FloorPlanner::performSA(CorblivarCore& corb) {
 	int i, ii;
-	int innerLoopMax;
+	int innerLoopMax, innerLoopLimit, innerLoopMaxInitial;
+	int ops_step;
+	double time_step_start;
+	bool time_budget_exceeded;
+	bool remove_checkpoint;
+	Equilibrium equilibrium;
 	int accepted_ops;
 	double accepted_ops_ratio;
 	bool op_success;
@@ -56,6 +64,7 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 	std::vector<double> cost_samples;
 	double cur_temp, init_temp;
 	double r;
+	double cost_threshold;
 	int layout_fit_counter;
 	double fitting_layouts_ratio;
 	bool valid_layout_found;
@@ -70,34 +79,103 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 		std::cout << "-> FloorPlanner::performSA(" << &corb << ")" << std::endl;
 	}
 
-	// for handling floorplacement benchmarks, i.e., floorplanning w/ very large
-	// blocks, we handle this naively by preferring these large blocks in the lower
-	// left corner, i.e., perform a sorting of the sequences by block size
-	//
-	// also, for random layout operations in SA phase one, these blocks are not
-	// allowed to be swapped or moved, see performOpMoveOrSwapBlocks
-	if (this->layoutOp.parameters.floorplacement) {
-		corb.sortCBLs(this->logMed(), CorblivarCore::SORT_CBLS_BY_BLOCKS_SIZE);
+	// very large designs may be handled by multilevel floorplanning, which in turn
+	// calls this handler for the coarse level and for refinement
+	if (this->schedule.multilevel && !this->multilevel_active && !this->IO_conf.checkpoint_resume && this->blocks.size() >= FloorPlanner::SA_MULTILEVEL_MIN_BLOCKS) {
+		return Multilevel::performSA(*this, corb);
 	}
 
-	// init SA: initial sampling; setup parameters, setup temperature schedule
-	this->initSA(corb, cost_samples, innerLoopMax, init_temp);
+	// resume interrupted SA run; restore the state as of the checkpoint
+	if (this->IO_conf.checkpoint_resume) {
 
-	/// main SA loop
-	//
-	// init loop parameters
-	i = 1;
-	cur_temp = init_temp;
-	cooling_phase = TempPhase::PHASE_1;
-	SA_phase_two = SA_phase_two_init = false;
-	valid_layout_found = false;
-	i_valid_layout_found = Point::UNDEF;
-	fitting_layouts_ratio = 0.0;
-	// dummy large value to accept first fitting solution
-	best_cost = 10e6 * Math::stdDev(cost_samples);
+		IO::readCheckpoint(*this, corb);
+
+		/// main SA loop
+		//
+		// init loop parameters
+		i = this->SA_state.iteration;
+		cur_temp = this->SA_state.temp;
+		cooling_phase = this->SA_state.cooling_phase;
+		SA_phase_two = this->SA_state.SA_phase_two;
+		SA_phase_two_init = false;
+		valid_layout_found = this->SA_state.valid_layout_found;
+		i_valid_layout_found = this->SA_state.iteration_first_valid_layout;
+		fitting_layouts_ratio = this->SA_state.fitting_layouts_ratio;
+		best_cost = this->SA_state.best_cost;
+		innerLoopMax = this->SA_state.innerLoopMax;
+		innerLoopMaxInitial = this->SA_state.innerLoopMaxInitial;
+
+		// continue the random-number sequence as of the checkpoint
+		Math::seedRand(this->SA_state.seed);
+
+		// continue time logging as if the run was not interrupted, also
+		// required for time budgets
+		this->time_start -= std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(this->SA_state.elapsed_time));
+
+		if (this->logMed()) {
+			std::cout << "SA> Resume simulated annealing process..." << std::endl;
+			if (SA_phase_two) {
+				std::cout << "SA> Phase II: optimizing within outline..." << std::endl;
+			}
+			else {
+				std::cout << "SA> Phase I: packing blocks into outline..." << std::endl;
+			}
+			std::cout << "SA> " << std::endl;
+		}
+	}
+	else {
+		// for handling floorplacement benchmarks, i.e., floorplanning w/ very
+		// large blocks, we handle this naively by preferring these large blocks
+		// in the lower left corner, i.e., perform a sorting of the sequences by
+		// block size
+		//
+		// also, for random layout operations in SA phase one, these blocks are
+		// not allowed to be swapped or moved, see performOpMoveOrSwapBlocks
+		//
+		// for multilevel runs, the sorting is handled by Multilevel
+		if (this->layoutOp.parameters.floorplacement && !this->multilevel_active) {
+			corb.sortCBLs(this->logMed(), CorblivarCore::SORT_CBLS_BY_BLOCKS_SIZE);
+		}
+
+		// init SA: initial sampling; setup parameters, setup temperature schedule
+		this->initSA(corb, cost_samples, innerLoopMax, init_temp);
+
+		/// main SA loop
+		//
+		// init loop parameters
+		i = 1;
+		cur_temp = init_temp;
+		cooling_phase = TempPhase::PHASE_1;
+		SA_phase_two = SA_phase_two_init = false;
+		valid_layout_found = false;
+		i_valid_layout_found = Point::UNDEF;
+		fitting_layouts_ratio = 0.0;
+		// dummy large value to accept first fitting solution
+		best_cost = 10e6 * Math::stdDev(cost_samples);
+
+		// time budget; memorize initial inner-loop ops, the schedule is adapted
+		// according to the ops per time observed in the following
+		innerLoopMaxInitial = innerLoopMax;
+	}
+	time_budget_exceeded = false;
+
+	// checkpoints are only valid until the SA run is completed; this applies to
+	// checkpoints written during this run as well as to the one the run was
+	// resumed from
+	remove_checkpoint = this->IO_conf.checkpoint_resume;
 
 	/// outer loop: annealing -- temperature steps
-	while (i <= this->schedule.loop_limit) {
+	while (i <= this->schedule.loop_limit && !time_budget_exceeded) {
+
+		// for adaptive inner loops, the loop is stopped once quasi-equilibrium is
+		// detected; if not, the loop is extended up to the following limit
+		if (FloorPlanner::SA_ADAPTIVE_INNER_LOOP) {
+			innerLoopLimit = FloorPlanner::SA_EQUILIBRIUM_LOOP_EXTENSION * innerLoopMax;
+			equilibrium.window = std::max(1, static_cast<int>(FloorPlanner::SA_EQUILIBRIUM_WINDOW_RATIO * innerLoopMax));
+		}
+		else {
+			innerLoopLimit = innerLoopMax;
+		}
 
 		if (this->logMax()) {
 			std::cout << "SA> Optimization step: " << i << "/" << this->schedule.loop_limit << std::endl;
@@ -110,13 +188,18 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 		layout_fit_counter = 0;
 		SA_phase_two_init = false;
 		best_sol_found = false;
+		ops_step = 0;
+		time_step_start = this->elapsedTime();
+		equilibrium.count = 0;
+		equilibrium.sum = equilibrium.sq_sum = 0.0;
+		equilibrium.prev_valid = false;
 
 		// init cost for current layout and fitting ratio
 		this->generateLayout(corb, this->opt_flags.alignment && SA_phase_two);
 		cur_cost = this->evaluateLayout(corb.getAlignments(), fitting_layouts_ratio, SA_phase_two).total_cost;
 
 		// inner loop: layout operations
-		while (ii <= innerLoopMax) {
+		while (ii <= innerLoopLimit) {
 
 			// perform layout op
 			op_success = layoutOp.performLayoutOp(corb, layout_fit_counter, SA_phase_two, false, (cooling_phase == TempPhase::PHASE_3));
@@ -124,6 +207,7 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 			if (op_success) {
 
 				prev_cost = cur_cost;
+				ops_step++;
 
 				// generate layout; also memorize whether layout is valid;
 				// note that this return value is only effective if
@@ -144,8 +228,21 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 					exit(1);
 				}
 
+				// determine acceptance threshold before evaluation; the
+				// Metropolis criterion r <= exp(- cost_diff / cur_temp)
+				// is equivalent to cur_cost <= prev_cost - cur_temp *
+				// ln(r); this way, the evaluation can be stopped as soon
+				// as the layout is known to be rejected
+				if (FloorPlanner::SA_EARLY_REJECTION) {
+					r = Math::randF(0, 1);
+					cost_threshold = prev_cost - cur_temp * std::log(r);
+				}
+				else {
+					cost_threshold = std::numeric_limits<double>::infinity();
+				}
+
 				// evaluate layout, new cost
-				cost = this->evaluateLayout(corb.getAlignments(), fitting_layouts_ratio, SA_phase_two);
+				cost = this->evaluateLayout(corb.getAlignments(), fitting_layouts_ratio, SA_phase_two, false, false, cost_threshold);
 				cur_cost = cost.total_cost;
 				// cost difference
 				cost_diff = cur_cost - prev_cost;
@@ -157,20 +254,31 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 
 				// revert solution w/ worse or same cost, depending on temperature
 				accept = true;
-				if (cost_diff >= 0.0) {
+				if (FloorPlanner::SA_EARLY_REJECTION) {
+					if (cost.rejected_early || cur_cost > cost_threshold) {
+						accept = false;
+					}
+				}
+				else if (cost_diff >= 0.0) {
 					r = Math::randF(0, 1);
 					if (r > exp(- cost_diff / cur_temp)) {
-
-						if (FloorPlanner::DBG_SA) {
-							std::cout << "DBG_SA> Revert op" << std::endl;
-						}
 						accept = false;
+					}
+				}
+
+				// feedback for adaptive op selection
+				layoutOp.updateOpStatistics(accept, -cost_diff, cost.evaluation_stages);
 
-						// revert last op
-						layoutOp.performLayoutOp(corb, layout_fit_counter, SA_phase_two, true);
-						// reset cost according to reverted CBL
-						cur_cost = prev_cost;
+				if (!accept) {
+
+					if (FloorPlanner::DBG_SA) {
+						std::cout << "DBG_SA> Revert op" << std::endl;
 					}
+
+					// revert last op
+					layoutOp.performLayoutOp(corb, layout_fit_counter, SA_phase_two, true);
+					// reset cost according to reverted CBL
+					cur_cost = prev_cost;
 				}
 
 				// solution to be accepted, i.e., previously not reverted
@@ -218,6 +326,11 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 								// switch phase
 								SA_phase_two = SA_phase_two_init = true;
 
+								// reset statistics for adaptive op
+								// selection, as the cost function
+								// changes
+								layoutOp.resetOpStatistics();
+
 								// re-calculate cost for new phase; assume
 								// fitting ratio 1.0 for initialization
 								// and for effective comparison of further
@@ -317,14 +430,36 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 					}
 				}
 
+				// time budget exceeded; stop annealing, the best solution
+				// found so far is retained anyway
+				if (this->schedule.time_budget > 0.0 && this->elapsedTime() >= this->schedule.time_budget) {
+
+					if (this->logMed()) {
+						std::cout << "SA> Time budget exceeded; stop annealing ..." << std::endl;
+					}
+
+					time_budget_exceeded = true;
+					break;
+				}
 				// after phase transition, skip current global iteration
 				// in order to consider updated cost function
-				if (SA_phase_two_init) {
+				else if (SA_phase_two_init) {
 					break;
 				}
 				// consider next loop iteration
 				else {
 					ii++;
+
+					// stop inner loop once quasi-equilibrium is
+					// reached
+					if (FloorPlanner::SA_ADAPTIVE_INNER_LOOP && this->updateEquilibrium(equilibrium, cur_cost)) {
+
+						if (FloorPlanner::DBG_SA) {
+							std::cout << "DBG_SA> Equilibrium reached after inner step: " << ii - 1 << "/" << innerLoopMax << std::endl;
+						}
+
+						break;
+					}
 				}
 			}
 		}
@@ -448,13 +583,62 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 		cur_step.cost_best_sol = best_cost;
 		this->tempSchedule.push_back(std::move(cur_step));
 
+		// adapt schedule to time budget; note that this has to happen before
+		// updating the temperature, since the cooling rate depends on the
+		// outer-loop limit
+		if (this->schedule.time_budget > 0.0 && !time_budget_exceeded) {
+			this->adaptScheduleToTimeBudget(i, ops_step, time_step_start, SA_phase_two, innerLoopMaxInitial, innerLoopMax);
+		}
+
 		// update SA temperature
 		cooling_phase = this->updateTemp(cur_temp, i, i_valid_layout_found);
 
+		// distributed SA; exchange best solution w/ other workers, only for SA
+		// phase two where the cost terms are normalized
+		if (this->coordinator_socket != -1 && SA_phase_two && i % FloorPlanner::SA_DISTRIBUTED_EXCHANGE_INTERVAL == 0 && !time_budget_exceeded) {
+			this->exchangeBestSolution(corb, best_cost);
+		}
+
+		// write checkpoint, representing the state for the next outer step; not for
+		// multilevel runs, where the checkpoint file is reset
+		if (this->schedule.checkpoint_interval > 0 && i % this->schedule.checkpoint_interval == 0 && i < this->schedule.loop_limit && !time_budget_exceeded && !this->IO_conf.checkpoint_file.empty()) {
+
+			this->SA_state.iteration = i + 1;
+			this->SA_state.temp = cur_temp;
+			this->SA_state.cooling_phase = cooling_phase;
+			this->SA_state.SA_phase_two = SA_phase_two;
+			this->SA_state.valid_layout_found = valid_layout_found;
+			this->SA_state.iteration_first_valid_layout = i_valid_layout_found;
+			this->SA_state.fitting_layouts_ratio = fitting_layouts_ratio;
+			this->SA_state.best_cost = best_cost;
+			this->SA_state.innerLoopMax = innerLoopMax;
+			this->SA_state.innerLoopMaxInitial = innerLoopMaxInitial;
+			this->SA_state.elapsed_time = this->elapsedTime();
+
+			// the state of the random-number generator cannot be retrieved;
+			// thus, re-initialize the generator w/ a seed drawn from the
+			// current sequence, and memorize that seed
+			this->SA_state.seed = Math::drawSeed();
+			Math::seedRand(this->SA_state.seed);
+
+			IO::writeCheckpoint(*this, corb);
+			remove_checkpoint = true;
+		}
+
 		// consider next outer step
 		i++;
 	}
 
+	// distributed SA; final exchange
+	if (this->coordinator_socket != -1) {
+		this->exchangeBestSolution(corb, best_cost, true);
+	}
+
+	// the SA run is completed; the checkpoint is obsolete
+	if (remove_checkpoint) {
+		std::remove(this->IO_conf.checkpoint_file.c_str());
+	}
+
 	if (this->logMed()) {
 		std::cout << "SA> Done" << std::endl;
 		std::cout << std::endl;
@@ -467,6 +651,149 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 	return valid_layout_found;
 }
 
+void FloorPlanner::exchangeBestSolution(CorblivarCore& corb, double& best_cost, bool const& final) {
+	std::string solution, global_solution;
+	std::stringstream global_solution_in;
+	double global_cost;
+	Cost cost;
+
+	// retrieve best solution; backup current solution
+	corb.backupCBLs();
+	if (corb.applyBestCBLs(false)) {
+		solution = corb.CBLsString();
+	}
+	corb.restoreCBLs();
+
+	if (final) {
+		DistributedSA::finish(this->coordinator_socket, best_cost, solution);
+		return;
+	}
+
+	if (!DistributedSA::exchange(this->coordinator_socket, best_cost, solution, global_cost, global_solution)) {
+		return;
+	}
+
+	// evaluate global best solution w/ own cost function, i.e., w/ own
+	// normalization of cost terms; the current solution is still backed up
+	global_solution_in.str(global_solution);
+	IO::parseCorblivarSolution(*this, corb, global_solution_in);
+
+	this->generateLayout(corb, this->opt_flags.alignment);
+	cost = this->evaluateLayout(corb.getAlignments(), 1.0, true);
+
+	// adopt global best solution as best and current solution, i.e., restart
+	// annealing from that solution
+	if (cost.fits_fixed_outline && cost.total_cost < best_cost) {
+
+		if (this->logMed()) {
+			std::cout << "SA> Adopt global best solution; cost: " << cost.total_cost << " (own best solution: " << best_cost << ", coordinator: " << global_cost << ")" << std::endl;
+		}
+
+		best_cost = cost.total_cost;
+		corb.storeBestCBLs();
+	}
+	else {
+		corb.restoreCBLs();
+	}
+}
+
+/// the ops per time are estimated from the current temperature step; the budget
+/// remaining is distributed evenly over the remaining steps; in case this results in
+/// too few ops per step, the outer-loop limit is reduced, which also speeds up cooling
+/// in updateTemp()
+///
+/// note that ops in SA phase one are much cheaper than in phase two (where all cost
+/// terms are evaluated); thus, inner loops are not extended during phase one, otherwise
+/// the budget would be spent too early
+void FloorPlanner::adaptScheduleToTimeBudget(int const& iteration, int const& ops_step, double const& time_step_start, bool const& SA_phase_two, int const& innerLoopMaxInitial, int& innerLoopMax) {
+	double time_elapsed, time_per_op;
+	double ops_remaining;
+	int steps_remaining;
+
+	// sanity check
+	if (ops_step == 0) {
+		return;
+	}
+
+	time_elapsed = this->elapsedTime();
+	// consider timer resolution of 1 ms
+	time_per_op = std::max(time_elapsed - time_step_start, 1.0e-3) / ops_step;
+
+	// ops which can be performed w/in remaining budget
+	ops_remaining = std::max(0.0, this->schedule.time_budget - time_elapsed) / time_per_op;
+
+	// reduce remaining temperature steps if required; consider at least one step
+	steps_remaining = static_cast<int>(this->schedule.loop_limit) - iteration;
+	if (ops_remaining < steps_remaining * FloorPlanner::SA_TIME_BUDGET_MIN_INNER_LOOP) {
+		steps_remaining = std::max(1, static_cast<int>(ops_remaining / FloorPlanner::SA_TIME_BUDGET_MIN_INNER_LOOP));
+		this->schedule.loop_limit = iteration + steps_remaining;
+	}
+	// no steps remaining anyway
+	else if (steps_remaining <= 0) {
+		return;
+	}
+
+	// distribute remaining ops evenly; limit extension of inner loops
+	innerLoopMax = static_cast<int>(ops_remaining / steps_remaining);
+	innerLoopMax = std::max(innerLoopMax, FloorPlanner::SA_TIME_BUDGET_MIN_INNER_LOOP);
+	if (SA_phase_two) {
+		innerLoopMax = std::min(innerLoopMax, static_cast<int>(FloorPlanner::SA_TIME_BUDGET_MAX_INNER_LOOP_FACTOR * innerLoopMaxInitial));
+	}
+	else {
+		innerLoopMax = std::min(innerLoopMax, innerLoopMaxInitial);
+	}
+
+	if (this->logMax()) {
+		std::cout << "SA>  Time budget; remaining [s]: " << this->schedule.time_budget - time_elapsed;
+		std::cout << ", ops per second: " << 1.0 / time_per_op;
+		std::cout << ", (new) outer-loop limit: " << this->schedule.loop_limit;
+		std::cout << ", (new) inner-loop ops: " << innerLoopMax << std::endl;
+	}
+}
+
+/// variance-based equilibrium detection: the cost of the Markov chain's states is
+/// sampled in consecutive windows of ops; once the avg cost of the current window
+/// differs from the previous window's avg by no more than the standard error of that
+/// difference (scaled by SA_EQUILIBRIUM_TOLERANCE), the chain is considered to be in
+/// quasi-equilibrium for the current temperature; chains which are still drifting, as
+/// it's the case near phase transitions, are not stopped
+bool FloorPlanner::updateEquilibrium(Equilibrium& equilibrium, double const& cost) const {
+	double avg, var;
+	bool reached;
+
+	equilibrium.sum += cost;
+	equilibrium.sq_sum += cost * cost;
+	equilibrium.count++;
+
+	// window not complete yet
+	if (equilibrium.count < equilibrium.window) {
+		return false;
+	}
+
+	avg = equilibrium.sum / equilibrium.count;
+	// sanity check for negative values due to rounding
+	var = std::max(0.0, equilibrium.sq_sum / equilibrium.count - avg * avg);
+
+	// compare to previous window; note that frozen chains, i.e., w/ zero variance in
+	// both windows, are also in equilibrium
+	if (equilibrium.prev_valid) {
+		reached = std::abs(avg - equilibrium.prev_avg) <=
+			FloorPlanner::SA_EQUILIBRIUM_TOLERANCE * std::sqrt((var + equilibrium.prev_var) / equilibrium.count);
+	}
+	else {
+		reached = false;
+	}
+
+	// current window becomes previous window
+	equilibrium.prev_avg = avg;
+	equilibrium.prev_var = var;
+	equilibrium.prev_valid = true;
+	equilibrium.count = 0;
+	equilibrium.sum = equilibrium.sq_sum = 0.0;
+
+	return reached;
+}
+
 FloorPlanner::TempPhase FloorPlanner::updateTemp(double& cur_temp, int const& iteration, int const& iteration_first_valid_layout) const {
 	float loop_factor;
 	double prev_temp;
@@ -625,21 +952,27 @@ void FloorPlanner::initSA(CorblivarCore& corb, std::vector<double>& cost_samples
 		std::cout << "SA> " << std::endl;
 	}
 
+	// reset statistics for adaptive op selection; the sampling above considered no
+	// feedback anyway
+	layoutOp.resetOpStatistics();
+
 	// restore initial CBLs
 	corb.restoreCBLs();
 }
 
-void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost, bool const& handle_corblivar) {
-	struct timeb end;
+void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost, bool const& handle_corblivar, bool const& wait_for_output) {
 	std::stringstream runtime;
 	bool valid_solution;
+	bool write_thermal_files;
+	std::vector<CorblivarAlignmentReq> alignments;
+	std::streambuf* log_target;
 	Cost cost;
 	unsigned i;
 	int clustered_TSVs;
 	double avg_peak_temp, avg_base_temp, avg_temp_gradient, avg_score, avg_bins_count;
 
 	if (FloorPlanner::DBG_CALLS_SA) {
-		std::cout << "-> FloorPlanner::finalize(" << &corb << ", " << determ_overall_cost << ", " << handle_corblivar << ")" << std::endl;
+		std::cout << "-> FloorPlanner::finalize(" << &corb << ", " << determ_overall_cost << ", " << handle_corblivar << ", " << wait_for_output << ")" << std::endl;
 	}
 
 	// consider as regular Corblivar run
@@ -671,64 +1004,64 @@ void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost
 			// solution files
 			if (determ_overall_cost) {
 				std::cout << "Corblivar> Final (adapted) cost: " << cost.total_cost << std::endl;
-				this->IO_conf.results << "Final (adapted) cost: " << cost.total_cost << std::endl;
+				this->IO_conf.results << "Final (adapted) cost: " << cost.total_cost << "\n";
 			}
 			else {
 				std::cout << "Corblivar> Final (adapted) cost: N/A" << std::endl;
-				this->IO_conf.results << "Final (adapted) cost: N/A" << std::endl;
+				this->IO_conf.results << "Final (adapted) cost: N/A" << "\n";
 			}
 
 			std::cout << "Corblivar> Max blocks-area die-area ratio: " << cost.area_actual_value << std::endl;
-			this->IO_conf.results << "Max blocks-area die-area ratio: " << cost.area_actual_value << std::endl;
-			this->IO_conf.results << std::endl;
+			this->IO_conf.results << "Max blocks-area die-area ratio: " << cost.area_actual_value << "\n";
+			this->IO_conf.results << "\n";
 
 			std::cout << "Corblivar> Overall deadspace [%]: " << 100.0 * (this->IC.stack_deadspace / this->IC.stack_area) << std::endl;
-			this->IO_conf.results << "Overall deadspace [%]: " << 100.0 * (this->IC.stack_deadspace / this->IC.stack_area) << std::endl;
-			this->IO_conf.results << std::endl;
+			this->IO_conf.results << "Overall deadspace [%]: " << 100.0 * (this->IC.stack_deadspace / this->IC.stack_area) << "\n";
+			this->IO_conf.results << "\n";
 
 			std::cout << "Corblivar> Overall blocks outline (final die outline):" << std::endl;
 			std::cout << "Corblivar>  w [um] = " << this->IC.outline_x << std::endl;
 			std::cout << "Corblivar>  h [um] = " << this->IC.outline_y << std::endl;
 			std::cout << "Corblivar>  A [cm^2] = " << this->IC.die_area * 1.0e-8 << std::endl;
-			this->IO_conf.results << "Overall blocks outline (final die outline):" << std::endl;
-			this->IO_conf.results << " w [um] = " << this->IC.outline_x << std::endl;
-			this->IO_conf.results << " h [um] = " << this->IC.outline_y << std::endl;
-			this->IO_conf.results << " A [cm^2] = " << this->IC.die_area * 1.0e-8 << std::endl;
-			this->IO_conf.results << std::endl;
+			this->IO_conf.results << "Overall blocks outline (final die outline):" << "\n";
+			this->IO_conf.results << " w [um] = " << this->IC.outline_x << "\n";
+			this->IO_conf.results << " h [um] = " << this->IC.outline_y << "\n";
+			this->IO_conf.results << " A [cm^2] = " << this->IC.die_area * 1.0e-8 << "\n";
+			this->IO_conf.results << "\n";
 
 			if (this->opt_flags.alignment) {
 				std::cout << "Corblivar> Alignment mismatches [um]: " << cost.alignments_actual_value << std::endl;
-				this->IO_conf.results << "Alignment mismatches [um]: " << cost.alignments_actual_value << std::endl;
-				this->IO_conf.results << std::endl;
+				this->IO_conf.results << "Alignment mismatches [um]: " << cost.alignments_actual_value << "\n";
+				this->IO_conf.results << "\n";
 			}
 
 			std::cout << "Corblivar> Total power for blocks, wires and TSVs [W]: " << cost.power_blocks + cost.power_wires + cost.power_TSVs << std::endl;
-			this->IO_conf.results << "Total power for blocks, wires and TSVs [W]: " << cost.power_blocks + cost.power_wires + cost.power_TSVs << std::endl;
-			this->IO_conf.results << std::endl;
+			this->IO_conf.results << "Total power for blocks, wires and TSVs [W]: " << cost.power_blocks + cost.power_wires + cost.power_TSVs << "\n";
+			this->IO_conf.results << "\n";
 
 			std::cout << "Corblivar> HPWL: " << cost.HPWL_actual_value << std::endl;
-			this->IO_conf.results << "HPWL: " << cost.HPWL_actual_value << std::endl;
-			this->IO_conf.results << std::endl;
+			this->IO_conf.results << "HPWL: " << cost.HPWL_actual_value << "\n";
+			this->IO_conf.results << "\n";
 
 			std::cout << "Corblivar>  Power for HPWL [W]: " << cost.power_wires << std::endl;
-			this->IO_conf.results << " Power for HPWL [W]: " << cost.power_wires << std::endl;
-			this->IO_conf.results << std::endl;
+			this->IO_conf.results << " Power for HPWL [W]: " << cost.power_wires << "\n";
+			this->IO_conf.results << "\n";
 
 			if (this->opt_flags.routing_util) {
 				std::cout << "Corblivar> Max routing utilization: " << cost.routing_util_actual_value << std::endl;
-				this->IO_conf.results << "Max routing utilization: " << cost.routing_util_actual_value << std::endl;
-				this->IO_conf.results << std::endl;
+				this->IO_conf.results << "Max routing utilization: " << cost.routing_util_actual_value << "\n";
+				this->IO_conf.results << "\n";
 			}
 
 			std::cout << "Corblivar> TSVs (w/o dummy TSVs): " << cost.TSVs_actual_value << std::endl;
-			this->IO_conf.results << "TSVs (w/o dummy TSVs): " << cost.TSVs_actual_value << std::endl;
+			this->IO_conf.results << "TSVs (w/o dummy TSVs): " << cost.TSVs_actual_value << "\n";
 
 			std::cout << "Corblivar>  Power for TSVs [W]: " << cost.power_TSVs << std::endl;
-			this->IO_conf.results << " Power for TSVs [W]: " << cost.power_TSVs << std::endl;
-			this->IO_conf.results << std::endl;
+			this->IO_conf.results << " Power for TSVs [W]: " << cost.power_TSVs << "\n";
+			this->IO_conf.results << "\n";
 
 			std::cout << "Corblivar>  TSV islands: " << this->TSVs.size() << std::endl;
-			this->IO_conf.results << " TSV islands: " << this->TSVs.size() << std::endl;
+			this->IO_conf.results << " TSV islands: " << this->TSVs.size() << "\n";
 
 			if (!this->TSVs.empty()) {
 
@@ -738,20 +1071,20 @@ void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost
 				}
 
 				std::cout << "Corblivar>  Avg TSV count per island: " << clustered_TSVs / this->TSVs.size() << std::endl;
-				this->IO_conf.results << " Avg TSV count per island: " << clustered_TSVs / this->TSVs.size() << std::endl;
+				this->IO_conf.results << " Avg TSV count per island: " << clustered_TSVs / this->TSVs.size() << "\n";
 			}
 
 			std::cout << "Corblivar>  Deadspace utilization by TSVs [%]: " << 100.0 * cost.TSVs_area_deadspace_ratio << std::endl;
-			this->IO_conf.results << " Deadspace utilization by TSVs [%]: " << 100.0 * cost.TSVs_area_deadspace_ratio << std::endl;
-			this->IO_conf.results << std::endl;
+			this->IO_conf.results << " Deadspace utilization by TSVs [%]: " << 100.0 * cost.TSVs_area_deadspace_ratio << "\n";
+			this->IO_conf.results << "\n";
 
 			std::cout << "Corblivar> Dummy TSVs: " << this->dummy_TSVs.size() << std::endl;
-			this->IO_conf.results << "Dummy TSVs: " << this->dummy_TSVs.size() << std::endl;
+			this->IO_conf.results << "Dummy TSVs: " << this->dummy_TSVs.size() << "\n";
 
 			if (!this->clustering.hotspots.empty()) {
 
 				std::cout << "Corblivar> Hotspot regions (on lowest layer 0): " << this->clustering.hotspots.size() << std::endl;
-				this->IO_conf.results << "Hotspot regions (on lowest layer 0): " << this->clustering.hotspots.size() << std::endl;
+				this->IO_conf.results << "Hotspot regions (on lowest layer 0): " << this->clustering.hotspots.size() << "\n";
 
 				avg_peak_temp = avg_base_temp = avg_temp_gradient = avg_score = avg_bins_count = 0.0;
 				for (Clustering::Hotspot const& cur_hotspot : this->clustering.hotspots) {
@@ -769,28 +1102,28 @@ void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost
 				avg_bins_count /= this->clustering.hotspots.size();
 
 				std::cout << "Corblivar>  Avg peak temp: " << avg_peak_temp << std::endl;
-				this->IO_conf.results << " Avg peak temp: " << avg_peak_temp << std::endl;
+				this->IO_conf.results << " Avg peak temp: " << avg_peak_temp << "\n";
 				std::cout << "Corblivar>  Avg base temp: " << avg_base_temp << std::endl;
-				this->IO_conf.results << " Avg base temp: " << avg_base_temp << std::endl;
+				this->IO_conf.results << " Avg base temp: " << avg_base_temp << "\n";
 				std::cout << "Corblivar>  Avg temp gradient: " << avg_temp_gradient << std::endl;
-				this->IO_conf.results << " Avg temp gradient: " << avg_temp_gradient << std::endl;
+				this->IO_conf.results << " Avg temp gradient: " << avg_temp_gradient << "\n";
 				std::cout << "Corblivar>  Avg score: " << avg_score << std::endl;
-				this->IO_conf.results << " Avg score: " << avg_score << std::endl;
+				this->IO_conf.results << " Avg score: " << avg_score << "\n";
 				std::cout << "Corblivar>  Avg bin count: " << avg_bins_count << std::endl;
-				this->IO_conf.results << " Avg bin count: " << avg_bins_count << std::endl;
+				this->IO_conf.results << " Avg bin count: " << avg_bins_count << "\n";
 			}
-			this->IO_conf.results << std::endl;
+			this->IO_conf.results << "\n";
 
 			if (this->opt_flags.thermal) {
 				std::cout << "Corblivar> Temp (estimated max temp for lowest layer [K]): " << cost.thermal_actual_value << std::endl;
-				this->IO_conf.results << "Temp (estimated max temp for lowest layer [K]): " << cost.thermal_actual_value << std::endl;
-				this->IO_conf.results << std::endl;
+				this->IO_conf.results << "Temp (estimated max temp for lowest layer [K]): " << cost.thermal_actual_value << "\n";
+				this->IO_conf.results << "\n";
 			}
 
 			if (this->opt_flags.timing || this->opt_flags.voltage_assignment) {
 
 				std::cout << "Corblivar> Timing (max delay [ns]): " << cost.timing_actual_value << std::endl;
-				this->IO_conf.results << "Timing (max delay [ns]): " << cost.timing_actual_value << std::endl;
+				this->IO_conf.results << "Timing (max delay [ns]): " << cost.timing_actual_value << "\n";
 
 				// always display violation, also when it's negative
 				// (i.e., timing better than constraint)
@@ -806,10 +1139,10 @@ void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost
 				this->IO_conf.results << cost.timing_actual_value - this->IC.delay_threshold;
 				this->IO_conf.results << " / ";
 				this->IO_conf.results << cost.timing_actual_value * (100.0 / this->IC.delay_threshold) - 100.0;
-				this->IO_conf.results << std::endl;
+				this->IO_conf.results << "\n";
 				// is adapted dynamically for voltage assignment
-				this->IO_conf.results << "  Current timing threshold: " << this->IC.delay_threshold << std::endl;
-				this->IO_conf.results << std::endl;
+				this->IO_conf.results << "  Current timing threshold: " << this->IC.delay_threshold << "\n";
+				this->IO_conf.results << "\n";
 			}
 
 			if (this->opt_flags.voltage_assignment) {
@@ -824,39 +1157,65 @@ void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost
 				std::cout << "Corblivar>  Sum of level shifters: " << cost.voltage_assignment_level_shifter << std::endl;
 				std::cout << "Corblivar>  Max std dev of power densities: " << cost.voltage_assignment_power_variation_max << std::endl;
 				std::cout << "Corblivar>  Modules count: " << cost.voltage_assignment_modules_count << std::endl;
-				this->IO_conf.results << "Voltage assignment: " << std::endl;
-				this->IO_conf.results << " Power reduction for blocks [W]: " << cost.voltage_assignment_power_saving << std::endl;
+				this->IO_conf.results << "Voltage assignment: " << "\n";
+				this->IO_conf.results << " Power reduction for blocks [W]: " << cost.voltage_assignment_power_saving << "\n";
 				this->IO_conf.results << "  Total power (blocks, wires, TSVs) after power reduction [W]: "
-					<< cost.power_blocks + cost.power_wires + cost.power_TSVs << std::endl;
+					<< cost.power_blocks + cost.power_wires + cost.power_TSVs << "\n";
 				this->IO_conf.results << "  Total power (blocks, wires, TSVs) before power reduction [W]: "
-					<< cost.power_blocks + cost.voltage_assignment_power_saving + cost.max_power_wires + cost.max_power_TSVs << std::endl;
-				this->IO_conf.results << " Avg max corners: " << cost.voltage_assignment_corners_avg << std::endl;
-				this->IO_conf.results << " Sum of level shifters: " << cost.voltage_assignment_level_shifter << std::endl;
-				this->IO_conf.results << " Max std dev of power densities: " << cost.voltage_assignment_power_variation_max << std::endl;
-				this->IO_conf.results << " Modules count: " << cost.voltage_assignment_modules_count << std::endl;
-				this->IO_conf.results << std::endl;
+					<< cost.power_blocks + cost.voltage_assignment_power_saving + cost.max_power_wires + cost.max_power_TSVs << "\n";
+				this->IO_conf.results << " Avg max corners: " << cost.voltage_assignment_corners_avg << "\n";
+				this->IO_conf.results << " Sum of level shifters: " << cost.voltage_assignment_level_shifter << "\n";
+				this->IO_conf.results << " Max std dev of power densities: " << cost.voltage_assignment_power_variation_max << "\n";
+				this->IO_conf.results << " Modules count: " << cost.voltage_assignment_modules_count << "\n";
+				this->IO_conf.results << "\n";
 			}
 
 			if (this->opt_flags.thermal_leakage) {
 				std::cout << "Corblivar> Thermal leakage: " << std::endl;
 				std::cout << "Corblivar>  Avg spatial entropy of power maps: " << cost.thermal_leakage_entropy_actual_value << std::endl;
 				std::cout << "Corblivar>  Pearson correlation of power and thermal map for lowest layer: " << cost.thermal_leakage_correlation_actual_value << std::endl;
-				this->IO_conf.results << "Thermal leakage: " << std::endl;
-				this->IO_conf.results << " Avg spatial entropy of power maps: " << cost.thermal_leakage_entropy_actual_value << std::endl;
-				this->IO_conf.results << " Pearson correlation of power and thermal map for lowest layer: " << cost.thermal_leakage_correlation_actual_value << std::endl;
+				this->IO_conf.results << "Thermal leakage: " << "\n";
+				this->IO_conf.results << " Avg spatial entropy of power maps: " << cost.thermal_leakage_entropy_actual_value << "\n";
+				this->IO_conf.results << " Pearson correlation of power and thermal map for lowest layer: " << cost.thermal_leakage_correlation_actual_value << "\n";
 			}
 		}
 	}
 
-	// generate temperature-schedule data
-	IO::writeTempSchedule(*this);
+	// generate output files in background; the writer only reads the final layout
+	// and maps, which remain unmodified until the writer is done, see waitForOutput
+	//
+	// any previous writer has to be done first
+	this->waitForOutput();
+
+	write_thermal_files = (!handle_corblivar || valid_solution) && this->IO_conf.power_density_file_avail;
+	// the alignment requests are memorized separately, since the CorblivarCore may
+	// be modified once this call returns
+	alignments = corb.getAlignments();
+	// the writer logs like the calling thread, see BatchRunner
+	log_target = BatchRunner::log_target;
+
+	this->output_writer = std::thread([this, alignments, write_thermal_files, log_target]() {
 
-	// generate floorplan plots
-	IO::writeFloorplanGP(*this, corb.getAlignments());
+		BatchRunner::log_target = log_target;
+
+		// generate temperature-schedule data
+		IO::writeTempSchedule(*this);
+
+		// generate floorplan plots
+		IO::writeFloorplanGP(*this, alignments);
+
+		// thermal-analysis files
+		if (write_thermal_files) {
+			// generate power, thermal, routing-utilization and TSV-density maps
+			IO::writeMaps(*this);
+			// generate HotSpot files
+			IO::writeHotSpotFiles(*this);
+		}
+	});
 
 	// generate Corblivar data if solution file is used as output
 	if (handle_corblivar && this->IO_conf.solution_out.is_open()) {
-		this->IO_conf.solution_out << corb.CBLsString() << std::endl;
+		this->IO_conf.solution_out << corb.CBLsString() << "\n";
 		this->IO_conf.solution_out.close();
 
 		// delete file in case no valid solution was generated
@@ -865,20 +1224,17 @@ void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost
 		}
 	}
 
-	// thermal-analysis files
-	if ((!handle_corblivar || valid_solution) && this->IO_conf.power_density_file_avail) {
-		// generate power, thermal, routing-utilization and TSV-density maps
-		IO::writeMaps(*this);
-		// generate HotSpot files
-		IO::writeHotSpotFiles(*this);
+	// overall runtime comprises the output files, unless they are generated
+	// concurrently w/ subsequent work
+	if (wait_for_output) {
+		this->waitForOutput();
 	}
 
-	// determine overall runtime
-	ftime(&end);
+	// determine overall runtime, in ms resolution
 	if (this->logMin()) {
-		runtime << "Runtime: " << (1000.0 * (end.time - this->time_start.time) + (end.millitm - this->time_start.millitm)) / 1000.0 << " s";
+		runtime << "Runtime: " << std::round(1000.0 * this->elapsedTime()) / 1000.0 << " s";
 		std::cout << "Corblivar> " << runtime.str() << std::endl;
-		this->IO_conf.results << runtime.str() << std::endl;
+		this->IO_conf.results << runtime.str() << "\n";
 	}
 
 	// close IO_conf.results file
@@ -935,13 +1291,24 @@ bool FloorPlanner::generateLayout(CorblivarCore& corb, bool const& perform_align
 
 /// adaptive cost model w/ two phases: first phase considers only cost for packing into
 /// outline, second phase considers further factors like WL, thermal distr, etc.
-FloorPlanner::Cost FloorPlanner::evaluateLayout(std::vector<CorblivarAlignmentReq> const& alignments, double const& fitting_layouts_ratio, bool const& SA_phase_two, bool const& set_max_cost, bool const& finalize) {
-	Cost cost;
+///
+/// for regular SA iterations, the cost terms are evaluated in stages, from cheap to
+/// expensive ones; the evaluation stops as soon as the layout cannot be accepted
+/// anymore, i.e., as soon as the cost exceeds the given threshold
+FloorPlanner::Cost FloorPlanner::evaluateLayout(std::vector<CorblivarAlignmentReq> const& alignments, double const& fitting_layouts_ratio, bool const& SA_phase_two, bool const& set_max_cost, bool const& finalize, double const& cost_threshold) {
+	// note that value-initialization resets all cost terms to zero; required for
+	// staged evaluation
+	Cost cost = Cost();
+	bool staged;
 
 	if (FloorPlanner::DBG_CALLS_SA) {
-		std::cout << "-> FloorPlanner::evaluateLayout(" << &alignments << ", " << fitting_layouts_ratio << ", " << SA_phase_two << ", " << set_max_cost << ", " << finalize << ")" << std::endl;
+		std::cout << "-> FloorPlanner::evaluateLayout(" << &alignments << ", " << fitting_layouts_ratio << ", " << SA_phase_two << ", " << set_max_cost << ", " << finalize << ", " << cost_threshold << ")" << std::endl;
 	}
 
+	// staged evaluation only for regular SA iterations; max cost and final
+	// evaluations require all cost terms
+	staged = !set_max_cost && !finalize && !std::isinf(cost_threshold);
+
 	// phase one: consider only cost for packing into outline
 	if (!SA_phase_two) {
 
@@ -953,12 +1320,19 @@ FloorPlanner::Cost FloorPlanner::evaluateLayout(std::vector<CorblivarAlignmentRe
 		// invert weight of area and outline cost since it's the only cost term to
 		// be considered during phase one
 		cost.total_cost = cost.area_outline / this->weights.area_outline;
+
+		cost.evaluation_stages = 1;
 	}
 	// phase two: consider further cost factors
 	else {
 		// area and outline cost, already weighted w/ global weight factor
 		this->evaluateAreaOutline(cost, fitting_layouts_ratio, true);
 
+		cost.evaluation_stages++;
+		if (staged && this->rejectLayoutEarly(cost, cost_threshold)) {
+			return cost;
+		}
+
 		// determine voltage-assignment and/or timing cost; initially determine
 		// the timing information anyway and later on apply the actual optimized
 		// voltage volumes if required
@@ -997,6 +1371,11 @@ FloorPlanner::Cost FloorPlanner::evaluateLayout(std::vector<CorblivarAlignmentRe
 				= 0;
 		}
 
+		cost.evaluation_stages++;
+		if (staged && this->rejectLayoutEarly(cost, cost_threshold)) {
+			return cost;
+		}
+
 		// determine interconnects cost; also determines hotspot regions and
 		// clusters signal TSVs accordingly
 		//
@@ -1020,6 +1399,11 @@ FloorPlanner::Cost FloorPlanner::evaluateLayout(std::vector<CorblivarAlignmentRe
 			cost.TSVs_area_deadspace_ratio = 0.0;
 		}
 
+		cost.evaluation_stages++;
+		if (staged && this->rejectLayoutEarly(cost, cost_threshold)) {
+			return cost;
+		}
+
 		// cost for failed alignments (i.e., alignment mismatches)
 		//
 		// also annotates failed request, this provides feedback for further
@@ -1037,6 +1421,11 @@ FloorPlanner::Cost FloorPlanner::evaluateLayout(std::vector<CorblivarAlignmentRe
 			cost.alignments = cost.alignments_actual_value = 0.0;
 		}
 
+		cost.evaluation_stages++;
+		if (staged && this->rejectLayoutEarly(cost, cost_threshold)) {
+			return cost;
+		}
+
 		// temperature-distribution cost and profile
 		//
 		// note that a) vertical buses and TSV islands and b) voltage assignment
@@ -1055,6 +1444,11 @@ FloorPlanner::Cost FloorPlanner::evaluateLayout(std::vector<CorblivarAlignmentRe
 			cost.thermal = cost.thermal_actual_value = 0.0;
 		}
 
+		cost.evaluation_stages++;
+		if (staged && this->rejectLayoutEarly(cost, cost_threshold)) {
+			return cost;
+		}
+
 		// thermal-related leakage of power patterns; based on spatial entropy of power maps and on Pearson correlation of power and thermal maps
 		//
 		// for finalize calls, we need to initialize the max_cost
@@ -1069,6 +1463,8 @@ FloorPlanner::Cost FloorPlanner::evaluateLayout(std::vector<CorblivarAlignmentRe
 			cost.thermal_leakage = 0.0;
 		}
 
+		cost.evaluation_stages++;
+
 		// for finalize calls, re-determine interconnects and the resulting
 		// thermal profile in order to properly model hotspot cluster and TSV
 		// islands; the final / best solution's thermal distribution---which was
@@ -1146,6 +1542,65 @@ FloorPlanner::Cost FloorPlanner::evaluateLayout(std::vector<CorblivarAlignmentRe
 	return cost;
 }
 
+/// note that all cost terms but the thermal-leakage term are non-negative; thus, the cost
+/// of the terms evaluated so far is a lower bound for the total cost, once the
+/// thermal-leakage term is bounded as well
+bool FloorPlanner::rejectLayoutEarly(Cost& cost, double const& cost_threshold) const {
+	double partial_cost;
+
+	// weight and sum up cost terms evaluated so far, as for total cost in
+	// evaluateLayout(); terms not evaluated yet are zero
+	partial_cost = this->weights.WL * cost.HPWL
+		+ this->weights.routing_util * cost.routing_util
+		+ this->weights.TSVs * cost.TSVs
+		+ this->weights.alignment * cost.alignments
+		// sanity check for reasonable thermal cost, see evaluateLayout()
+		+ this->weights.thermal * (std::isinf(cost.thermal) ? 0.0 : cost.thermal)
+		+ this->weights.voltage_assignment * cost.voltage_assignment
+		+ this->weights.timing * cost.timing
+		// area, outline cost is already weighted
+		+ cost.area_outline;
+
+	// the thermal-leakage term is always evaluated last, i.e., it's still pending
+	// here
+	if (this->opt_flags.thermal_leakage && this->opt_flags.thermal && this->weights.thermal_leakage > 0.0) {
+		partial_cost += this->weights.thermal_leakage * this->lowerBoundThermalLeakage();
+	}
+
+	if (partial_cost > cost_threshold) {
+
+		if (FloorPlanner::DBG_SA) {
+			std::cout << "DBG_SA> Reject layout early; partial cost: " << partial_cost << ", threshold: " << cost_threshold << std::endl;
+		}
+
+		cost.total_cost = cost.total_cost_fitting = partial_cost;
+		cost.rejected_early = true;
+
+		return true;
+	}
+	else {
+		return false;
+	}
+}
+
+/// the spatial entropy is non-negative, whereas the Pearson correlation ranges b/w -1
+/// and 1; see evaluateLeakage() for the composition of the cost term
+double FloorPlanner::lowerBoundThermalLeakage() const {
+
+	// no sound bound for degenerated normalization values
+	if (
+		this->max_cost_thermal_leakage <= 0.0 ||
+		this->leakageAnalyzer.max_values.entropy <= 0.0 ||
+		this->leakageAnalyzer.max_values.correlation == 0.0 ||
+		this->leakageAnalyzer.parameters.weight_entropy < 0.0
+	   ) {
+		return -std::numeric_limits<double>::infinity();
+	}
+
+	return (- std::abs(this->leakageAnalyzer.parameters.weight_correlation) / std::abs(this->leakageAnalyzer.max_values.correlation))
+		/ this->max_cost_thermal_leakage;
+}
+
 /// determine the delays for all blocks; they shall fulfill a max delay below a given
 /// threshold
 void FloorPlanner::evaluateTiming(Cost& cost, bool const& set_max_cost, bool const& finalize, bool reevaluation) {
@@ -1408,8 +1863,9 @@ void FloorPlanner::evaluateLeakage(Cost& cost, double const& fitting_layouts_rat
 
 	// Pearson correlation of power map and thermal map
 	//
-	// power blurring provides only the thermal map for the lowermost die 0, hence the correlation can also be only calculated for this die
-	correlation = this->leakageAnalyzer.determinePearsonCorr(this->thermalAnalyzer.getPowerMapsOrig()[0], this->thermal_analysis.thermal_map);
+	// power blurring provides only the thermal map for the lowermost die 0, hence the correlation can also be only calculated for this die; the required sums are
+	// already determined during power blurring
+	correlation = this->leakageAnalyzer.determinePearsonCorr(this->thermal_analysis.stats);
 
 	// store actual values
 	cost.thermal_leakage_entropy_actual_value = entropy;
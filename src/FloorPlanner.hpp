@@ -29,6 +29,7 @@
 #include "Net.hpp"
 #include "LayoutOperations.hpp"
 #include "ThermalAnalyzer.hpp"
+#include "ThermalSolver.hpp"
 #include "LeakageAnalyzer.hpp"
 #include "Clustering.hpp"
 #include "RoutingUtilization.hpp"
@@ -58,6 +59,11 @@ class FloorPlanner {
 		/// chip/floorplan data
 		std::vector<Net> nets;
 
+		/// symbol tables, map ids of blocks/terminals to their indices; to be initialized once blocks are parsed
+		std::unordered_map<std::string, unsigned> blocks_ids;
+		/// symbol tables, map ids of blocks/terminals to their indices; to be initialized once blocks are parsed
+		std::unordered_map<std::string, unsigned> terminals_ids;
+
 		/// groups of TSVs, will be defined from nets and vertical buses
 		std::vector<TSV_Island> TSVs;
 		/// groups of dummy filler TSVs, required for minimum TSV density
@@ -142,6 +148,26 @@ class FloorPlanner {
 			bool alignments_file_avail;
 			/// flag whether benchmark is in GATech syntax/format or not
 			bool GT_benchmark;
+			/// benchmark image; binary file which memorizes the parsed blocks,
+			/// terminal pins and nets, such that subsequent runs can skip the
+			/// parsing of benchmark files; only used if activated in the config
+			bool benchmark_image;
+			/// benchmark image; file name, hash of related benchmark, and flag
+			/// whether the image holds valid data for blocks of this benchmark
+			std::string benchmark_image_file;
+			unsigned long long benchmark_image_hash;
+			bool benchmark_image_valid;
+			/// benchmark image; data of the valid image, i.e., header and
+			/// blocks section as read or written, kept for the nets section
+			std::string benchmark_image_data;
+			/// checkpoint file, and flag whether SA run is to be resumed from
+			/// given checkpoint
+			std::string checkpoint_file;
+			bool checkpoint_resume;
+			/// dir for all generated files, including trailing slash; empty
+			/// for the working dir; file names within generated files, e.g., in
+			/// gnuplot scripts, remain relative to this dir
+			std::string output_dir;
 		} IO_conf;
 
 		/// benchmark name
@@ -151,8 +177,16 @@ class FloorPlanner {
 		/// as command-line parameter
 		bool thermal_analyser_run;
 
-		/// time logging
-		struct timeb time_start;
+		/// time logging; monotonic clock, not affected by adjustments of the
+		/// system time
+		std::chrono::steady_clock::time_point time_start;
+
+		/// background writer for output files of finalize runs
+		std::thread output_writer;
+		/// time logging; elapsed wall-clock time [s] since start
+		inline double elapsedTime() const {
+			return std::chrono::duration<double>(std::chrono::steady_clock::now() - this->time_start).count();
+		}
 
 		/// logging
 		int log;
@@ -168,6 +202,19 @@ class FloorPlanner {
 			/// SA parameters: loop control
 			double loop_factor, loop_limit;
 
+			/// SA parameter: wall-clock time budget [s] for the overall run up
+			/// to the end of annealing; zero if not limited
+			double time_budget;
+
+			/// SA parameter: interval of temperature steps for checkpoints,
+			/// i.e., the state of the SA run is written into a checkpoint file
+			/// which allows to resume interrupted runs; zero if no checkpoints
+			int checkpoint_interval;
+
+			/// SA parameter: multilevel floorplanning, see Multilevel; only
+			/// for designs w/ at least SA_MULTILEVEL_MIN_BLOCKS blocks
+			bool multilevel;
+
 			/// SA parameter: scaling factor for initial temp
 			double temp_init_factor;
 
@@ -227,6 +274,12 @@ class FloorPlanner {
 			double thermal_leakage;
 			double thermal_leakage_entropy_actual_value;
 			double thermal_leakage_correlation_actual_value;
+			/// flag for layouts rejected during staged evaluation; the cost
+			/// terms are only partially determined then
+			bool rejected_early;
+			/// count of cost-evaluation stages performed; measure for the
+			/// evaluation effort
+			unsigned evaluation_stages;
 
 			// http://www.learncpp.com/cpp-tutorial/93-overloading-the-io-operators/
 			friend std::ostream& operator<< (std::ostream& out, Cost const& cost) {
@@ -240,7 +293,16 @@ class FloorPlanner {
 				double const& fitting_layouts_ratio = 0.0,
 				bool const& SA_phase_two = false,
 				bool const& set_max_cost = false,
-				bool const& finalize = false);
+				bool const& finalize = false,
+				double const& cost_threshold = std::numeric_limits<double>::infinity());
+		/// SA: staged evaluation; checks whether a partially evaluated layout can
+		/// already be rejected, i.e., whether the cost of the terms evaluated so
+		/// far plus lower bounds for the remaining terms exceeds the acceptance
+		/// threshold; remaining, not yet evaluated terms are expected to be zero
+		bool rejectLayoutEarly(Cost& cost, double const& cost_threshold) const;
+		/// SA: staged evaluation; lower bound for the normalized thermal-leakage
+		/// cost term
+		double lowerBoundThermalLeakage() const;
 		/// SA: cost functions, i.e., layout-evaluations
 		void evaluateThermalDistr(Cost& cost,
 				bool const& set_max_cost = false);
@@ -278,6 +340,10 @@ class FloorPlanner {
 
 		/// SA parameter: scaling factor for loops during solution-space sampling
 		static constexpr int SA_SAMPLING_LOOP_FACTOR = 1;
+		/// SA parameter: draw the Metropolis random number before layout
+		/// evaluation and stop evaluating cost terms as soon as the layout cannot
+		/// be accepted anymore
+		static constexpr bool SA_EARLY_REJECTION = true;
 
 		/// SA-related temperature step; POD declaration
 		struct TempStep {
@@ -294,11 +360,89 @@ class FloorPlanner {
 		/// SA: temperature-schedule log data
 		std::vector<TempStep> tempSchedule;
 
+		/// SA: checkpointing; state of the main SA loop, required for resuming
+		/// runs, in addition to the state kept in members; POD declaration
+		struct SAState {
+			int iteration;
+			double temp;
+			TempPhase cooling_phase;
+			bool SA_phase_two;
+			bool valid_layout_found;
+			int iteration_first_valid_layout;
+			double fitting_layouts_ratio;
+			double best_cost;
+			int innerLoopMax, innerLoopMaxInitial;
+			/// elapsed time [s] up to the checkpoint
+			double elapsed_time;
+			/// seed for re-initializing the random-number generator; its
+			/// internal state cannot be stored otherwise
+			unsigned seed;
+		};
+		/// SA: checkpointing; state of the main SA loop, as of the last
+		/// checkpoint written or read
+		SAState SA_state;
+
+		/// SA: multilevel floorplanning; min count of blocks
+		static constexpr unsigned SA_MULTILEVEL_MIN_BLOCKS = 500;
+		/// SA: multilevel floorplanning; flag for ongoing multilevel run, where
+		/// the SA handler is called for each level
+		bool multilevel_active;
+
+		/// SA: distributed SA; interval of temperature steps for exchanging the
+		/// best solution w/ the coordinator, see DistributedSA
+		static constexpr int SA_DISTRIBUTED_EXCHANGE_INTERVAL = 5;
+		/// SA: distributed SA; socket connected to the coordinator, -1 for
+		/// regular runs
+		int coordinator_socket;
+		/// SA: distributed SA; exchanges the best solution w/ the coordinator,
+		/// and adopts the global best solution if it is better than the local
+		/// one; for the final exchange, the best solution is only sent
+		void exchangeBestSolution(CorblivarCore& corb, double& best_cost, bool const& final = false);
+
 		/// SA: reheating parameters, for SA phase 3
 		static constexpr int SA_REHEAT_COST_SAMPLES = 3;
 		/// SA: reheating parameters, for SA phase 3
 		static constexpr double SA_REHEAT_STD_DEV_COST_LIMIT = 1.0e-4;
 
+		/// SA: adaptive inner-loop length; code switch; if not set, each
+		/// temperature step performs exactly innerLoopMax ops
+		static constexpr bool SA_ADAPTIVE_INNER_LOOP = true;
+		/// SA: adaptive inner-loop length; size of windows for equilibrium
+		/// detection, ratio of innerLoopMax
+		static constexpr double SA_EQUILIBRIUM_WINDOW_RATIO = 0.125;
+		/// SA: adaptive inner-loop length; max extension of inner loops, factor
+		/// for innerLoopMax
+		static constexpr double SA_EQUILIBRIUM_LOOP_EXTENSION = 2.0;
+		/// SA: adaptive inner-loop length; tolerance for the difference of avg
+		/// cost of consecutive windows, factor for the standard error of that
+		/// difference
+		static constexpr double SA_EQUILIBRIUM_TOLERANCE = 1.0;
+
+		/// SA: time budget; min inner-loop ops per temperature step; if the
+		/// budget doesn't allow for this, the outer-loop limit is reduced instead
+		static constexpr int SA_TIME_BUDGET_MIN_INNER_LOOP = 10;
+		/// SA: time budget; max extension of inner loops, factor for the initial
+		/// inner-loop ops
+		static constexpr double SA_TIME_BUDGET_MAX_INNER_LOOP_FACTOR = 10.0;
+		/// SA: time budget; rescales the outer-loop limit (and thereby the
+		/// cooling rate) and the inner-loop ops such that the remaining
+		/// temperature steps end on schedule
+		void adaptScheduleToTimeBudget(int const& iteration, int const& ops_step, double const& time_step_start, bool const& SA_phase_two, int const& innerLoopMaxInitial, int& innerLoopMax);
+
+		/// SA: equilibrium detection; statistics of cost in the current and the
+		/// previous window of ops; POD declaration
+		struct Equilibrium {
+			int window;
+			int count;
+			double sum, sq_sum;
+			double prev_avg, prev_var;
+			bool prev_valid;
+		};
+		/// SA: equilibrium detection; considers the current cost and returns
+		/// whether the chain has reached quasi-equilibrium, i.e., whether the avg
+		/// cost of the last two windows of ops are not significantly different
+		bool updateEquilibrium(Equilibrium& equilibrium, double const& cost) const;
+
 		/// layout-generation helper
 		bool generateLayout(CorblivarCore& corb, bool const& perform_alignment = false);
 
@@ -340,6 +484,9 @@ class FloorPlanner {
 		// (TODO) encapsulate in thermalAnalyzer
 		ThermalAnalyzer::ThermalAnalysisResult thermal_analysis;
 
+		/// thermal solver instance; in-process stand-in for HotSpot
+		ThermalSolver thermalSolver;
+
 		/// instance for thermal-related leakage analyzer
 		LeakageAnalyzer leakageAnalyzer;
 
@@ -363,15 +510,29 @@ class FloorPlanner {
 		/// default constructor
 		FloorPlanner() {
 			// memorize start time
-			ftime(&(this->time_start));
+			this->time_start = std::chrono::steady_clock::now();
 
 			// init random number generator
-			srand(time(0));
+			Math::seedRand(time(0));
+
+			// regular run, not connected to distributed-SA coordinator
+			this->coordinator_socket = -1;
+
+			// no multilevel run ongoing
+			this->multilevel_active = false;
+		}
+
+		/// destructor; output files have to be completed
+		~FloorPlanner() {
+			this->waitForOutput();
 		}
 
 	// public data, functions
 	public:
 		friend class IO;
+		friend class BatchRunner;
+		friend class DistributedSA;
+		friend class Multilevel;
 
 		/// logging
 		inline bool logMin() const {
@@ -446,6 +607,11 @@ class FloorPlanner {
 			return this->blocks;
 		};
 
+		/// getter
+		inline std::unordered_map<std::string, unsigned> const& getBlocksIds() const {
+			return this->blocks_ids;
+		};
+
 		/// getter
 		inline std::vector<Block> const& getWires() const {
 			return this->wires;
@@ -482,10 +648,39 @@ class FloorPlanner {
 		};
 
 		/// getter
-		inline ThermalAnalyzer::MaskParameters const& getPowerBlurringParameters() {
+		inline ThermalAnalyzer::MaskParameters const& getPowerBlurringParameters() const {
 			return this->power_blurring_parameters;
 		}
 
+		/// thermal solver: helper; parameters of the 3D-IC stack, the same as
+		/// considered in IO::writeHotSpotFiles
+		inline ThermalSolver::StackParameters getThermalStackParameters() const {
+			ThermalSolver::StackParameters parameters;
+
+			parameters.layers = this->IC.layers;
+			parameters.BEOL_thickness = this->techParameters.BEOL_thickness;
+			parameters.Si_active_thickness = this->techParameters.Si_active_thickness;
+			parameters.Si_passive_thickness = this->techParameters.Si_passive_thickness;
+			parameters.bond_thickness = this->techParameters.bond_thickness;
+			parameters.TSV_group_Cu_area_ratio = this->techParameters.TSV_group_Cu_area_ratio;
+			// for thermal-analyzer fitting runs, consider the uniform TSV
+			// density; otherwise the TSV densities of the power maps
+			parameters.uniform_TSV_density = this->thermal_analyser_run;
+			parameters.TSV_density = this->power_blurring_parameters.TSV_density;
+
+			return parameters;
+		}
+
+		/// thermal solver: handler; steady-state simulation of current layout
+		inline ThermalSolver::Result performThermalSimulation(bool const& log = false) {
+			return this->thermalSolver.performSteadyStateSimulation(this->getThermalStackParameters(), this->blocks, this->wires, this->getOutline(), this->thermalAnalyzer.getPowerMaps(), log);
+		}
+
+		/// getter
+		inline ThermalSolver const& getThermalSolver() const {
+			return this->thermalSolver;
+		};
+
 		/// helper for die geometry
 		///
 		inline Point shrinkDieOutlines() {
@@ -558,10 +753,24 @@ class FloorPlanner {
 			return this->IO_conf.solution_in.is_open();
 		};
 
+		/// file helper
+		///
+		inline bool resumeFromCheckpoint() const {
+			return this->IO_conf.checkpoint_resume;
+		};
+
 		/// SA: main handler
 		bool performSA(CorblivarCore& corb);
-		/// SA: finalize handler
-		void finalize(CorblivarCore& corb, bool const& determ_overall_cost = true, bool const& handle_corblivar = true);
+		/// SA: finalize handler; the output files are generated in background;
+		/// if not waiting for them here, the layout and maps must not be modified
+		/// until waitForOutput is called
+		void finalize(CorblivarCore& corb, bool const& determ_overall_cost = true, bool const& handle_corblivar = true, bool const& wait_for_output = true);
+		/// SA: finalize helper; waits for the output files to be completed
+		inline void waitForOutput() {
+			if (this->output_writer.joinable()) {
+				this->output_writer.join();
+			}
+		};
 };
 
 #endif
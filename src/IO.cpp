@@ -26,6 +26,16 @@
 // required Corblivar headers
 #include "FloorPlanner.hpp"
 #include "CorblivarCore.hpp"
+// required library headers
+#include <unistd.h>
+
+/// memory allocation
+constexpr int IO::BENCHMARK_IMAGE_VERSION;
+const std::string IO::BENCHMARK_IMAGE_MAGIC = "CORBLIVAR_IMAGE";
+constexpr int IO::CHECKPOINT_VERSION;
+const std::string IO::CHECKPOINT_MAGIC = "CORBLIVAR_CHECKPOINT";
+constexpr int IO::MAPS_BINARY_VERSION;
+const std::string IO::MAPS_BINARY_MAGIC = "CORBLIVAR_MAPS";
 
 /// parse program parameter, config file, and further files
 void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
@@ -54,8 +64,11 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 		std::cout << "IO> Mandatory parameter ``benchmark_name'': any name, should be same as benchmark's files names" << std::endl;
 		std::cout << "IO> Mandatory parameter ``config_file'' format: see provided Corblivar.conf" << std::endl;
 		std::cout << "IO> Mandatory parameter ``benchmarks_dir'': folder containing actual benchmark files" << std::endl;
-		std::cout << "IO> Optional parameter ``solution_file'': re-evaluate w/ given Corblivar solution" << std::endl;
+		std::cout << "IO> Optional parameter ``solution_file'': re-evaluate w/ given Corblivar solution, or resume SA run from given checkpoint file" << std::endl;
 		std::cout << "IO> Optional parameter ``TSV density'': average TSV density to be considered across all dies, to be given in \%" << std::endl;
+		std::cout << "IO> " << std::endl;
+		std::cout << "IO> Batch mode: " << argv[0] << " --batch manifest_file [threads]; see BatchRunner" << std::endl;
+		std::cout << "IO> Distributed SA: " << argv[0] << " --coordinator port workers [solution_file], and " << argv[0] << " --worker port benchmark_name ... for each worker; see DistributedSA" << std::endl;
 
 		exit(1);
 	}
@@ -92,9 +105,13 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 	nets_file << argv[3] << fp.benchmark << ".nets";
 	fp.IO_conf.nets_file = nets_file.str();
 
-	results_file << fp.benchmark << ".results";
+	results_file << fp.IO_conf.output_dir << fp.benchmark << ".results";
 	fp.IO_conf.results.open(results_file.str().c_str());
 
+	// benchmark image; put into working dir, along w/ results file
+	fp.IO_conf.benchmark_image_file = fp.IO_conf.output_dir + fp.benchmark + ".image";
+	fp.IO_conf.benchmark_image_valid = false;
+
 	GT_fp_file << argv[3] << fp.benchmark << ".fpi";
 	fp.IO_conf.GT_fp_file = GT_fp_file.str();
 
@@ -220,6 +237,11 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 		in.close();
 	}
 
+	// checkpoints of SA runs, if activated in the config, are written into the
+	// working dir, similar to solution files
+	fp.IO_conf.checkpoint_file = fp.IO_conf.output_dir + fp.benchmark + ".checkpoint";
+	fp.IO_conf.checkpoint_resume = false;
+
 	// additional command-line parameters
 	//
 	// additional parameter for solution file given; consider file for readin
@@ -227,17 +249,39 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 
 		fp.IO_conf.solution_file = argv[4];
 		// open file if possible
-		fp.IO_conf.solution_in.open(fp.IO_conf.solution_file.c_str());
+		fp.IO_conf.solution_in.open(fp.IO_conf.solution_file.c_str(), std::ios::binary);
 		if (!fp.IO_conf.solution_in.good())
 		{
 			std::cout << "IO> ";
 			std::cout << "No such solution file: " << fp.IO_conf.solution_file << std::endl;
 			exit(1);
 		}
+
+		// the file may also be a checkpoint, to be recognized by its magic
+		// string; then, the SA run is to be resumed, which results in a new
+		// solution file as for regular runs
+		tmpstr.resize(IO::CHECKPOINT_MAGIC.size());
+		fp.IO_conf.solution_in.read(&tmpstr[0], tmpstr.size());
+		fp.IO_conf.solution_in.close();
+
+		if (tmpstr == IO::CHECKPOINT_MAGIC) {
+			fp.IO_conf.checkpoint_resume = true;
+			fp.IO_conf.checkpoint_file = argv[4];
+
+			fp.IO_conf.solution_file = fp.IO_conf.output_dir + fp.benchmark + ".solution";
+			fp.IO_conf.solution_out.open(fp.IO_conf.solution_file.c_str());
+		}
+		// otherwise, reopen the solution file for regular parsing
+		else {
+			fp.IO_conf.solution_in.clear();
+			fp.IO_conf.solution_in.open(fp.IO_conf.solution_file.c_str());
+		}
+
+		tmpstr.clear();
 	}
 	// open new solution file
 	else {
-		fp.IO_conf.solution_file = fp.benchmark + ".solution";
+		fp.IO_conf.solution_file = fp.IO_conf.output_dir + fp.benchmark + ".solution";
 		fp.IO_conf.solution_out.open(fp.IO_conf.solution_file.c_str());
 	}
 
@@ -282,6 +326,11 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 		in >> tmpstr;
 	in >> fp.log;
 
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.IO_conf.benchmark_image;
+
 	in >> tmpstr;
 	while (tmpstr != "value" && !in.eof())
 		in >> tmpstr;
@@ -358,6 +407,33 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 		exit(1);
 	}
 
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.schedule.time_budget;
+
+	// sanity check for non-negative time budget
+	if (fp.schedule.time_budget < 0.0) {
+		std::cout << "IO> Provide non-negative SA time budget!" << std::endl;
+		exit(1);
+	}
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.schedule.checkpoint_interval;
+
+	// sanity check for non-negative checkpoint interval
+	if (fp.schedule.checkpoint_interval < 0) {
+		std::cout << "IO> Provide non-negative SA checkpoint interval!" << std::endl;
+		exit(1);
+	}
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.schedule.multilevel;
+
 	in >> tmpstr;
 	while (tmpstr != "value" && !in.eof())
 		in >> tmpstr;
@@ -927,6 +1003,7 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 
 		// log
 		std::cout << "IO>  Loglevel (1 to 3 for minimal, medium, maximal): " << fp.log << std::endl;
+		std::cout << "IO>  Benchmark image: " << fp.IO_conf.benchmark_image << std::endl;
 
 		// general 3D IC setup
 		std::cout << "IO>  Chip -- Layers for 3D IC: " << fp.IC.layers << std::endl;
@@ -1008,6 +1085,9 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 		// SA loop setup
 		std::cout << "IO>  SA -- Inner-loop operation-factor a (ops = N^a for N blocks): " << fp.schedule.loop_factor << std::endl;
 		std::cout << "IO>  SA -- Outer-loop upper limit: " << fp.schedule.loop_limit << std::endl;
+		std::cout << "IO>  SA -- Time budget [s] (0 for unlimited): " << fp.schedule.time_budget << std::endl;
+		std::cout << "IO>  SA -- Checkpoint interval [temperature steps] (0 for no checkpoints): " << fp.schedule.checkpoint_interval << std::endl;
+		std::cout << "IO>  SA -- Multilevel floorplanning (for designs w/ at least " << FloorPlanner::SA_MULTILEVEL_MIN_BLOCKS << " blocks): " << fp.schedule.multilevel << std::endl;
 
 		// SA cooling schedule
 		std::cout << "IO>  SA -- Start temperature scaling factor: " << fp.schedule.temp_init_factor << std::endl;
@@ -1066,6 +1146,24 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 
 /// parse Corblivar solution file, to rerun Corbliar w/ previous data
 void IO::parseCorblivarFile(FloorPlanner& fp, CorblivarCore& corb) {
+	unsigned tuples;
+
+	if (fp.logMed()) {
+		std::cout << "IO> ";
+		std::cout << "Initializing Corblivar data from solution file ..." << std::endl;
+	}
+
+	tuples = IO::parseCorblivarSolution(fp, corb, fp.IO_conf.solution_in);
+
+	if (fp.logMed()) {
+		std::cout << "IO> ";
+		std::cout << "Done; parsed " << tuples << " tuples" << std::endl << std::endl;
+	}
+}
+
+/// parse Corblivar solution, as written by CorblivarCore::CBLsString; the solution
+/// replaces the current CBLs
+unsigned IO::parseCorblivarSolution(FloorPlanner& fp, CorblivarCore& corb, std::istream& in) {
 	std::string tmpstr;
 	CornerBlockList::Tuple tuple;
 	unsigned tuples;
@@ -1074,46 +1172,46 @@ void IO::parseCorblivarFile(FloorPlanner& fp, CorblivarCore& corb) {
 	unsigned dir;
 	double width, height;
 
-	if (fp.logMed()) {
-		std::cout << "IO> ";
-		std::cout << "Initializing Corblivar data from solution file ..." << std::endl;
+	// reset CBLs
+	for (int i = 0; i < fp.getLayers(); i++) {
+		corb.editDie(i).editCBL().clear();
 	}
 
 	// drop solution file header
-	while (tmpstr != "data_start" && !fp.IO_conf.solution_in.eof()) {
-		fp.IO_conf.solution_in >> tmpstr;
+	while (tmpstr != "data_start" && !in.eof()) {
+		in >> tmpstr;
 	}
 
 	tuples = 0;
 	cur_layer = -1;
 
-	while (!fp.IO_conf.solution_in.eof()) {
-		fp.IO_conf.solution_in >> tmpstr;
+	while (!in.eof()) {
+		in >> tmpstr;
 
 		// new die; new CBL
 		if (tmpstr == "CBL") {
 			// drop "["
-			fp.IO_conf.solution_in >> tmpstr;
+			in >> tmpstr;
 
 			// layer id
-			fp.IO_conf.solution_in >> cur_layer;
+			in >> cur_layer;
 
 			// drop "]"
-			fp.IO_conf.solution_in >> tmpstr;
+			in >> tmpstr;
 		}
 		// new CBL tuple; new block
 		else if (tmpstr == "tuple") {
 			// drop tuple id
-			fp.IO_conf.solution_in >> tmpstr;
+			in >> tmpstr;
 			// drop ":"
-			fp.IO_conf.solution_in >> tmpstr;
+			in >> tmpstr;
 			// drop "("
-			fp.IO_conf.solution_in >> tmpstr;
+			in >> tmpstr;
 
 			// block id
-			fp.IO_conf.solution_in >> block_id;
+			in >> block_id;
 			// find related block
-			tuple.S = Block::findBlock(block_id, fp.blocks);
+			tuple.S = Block::findBlock(block_id, fp.blocks, fp.blocks_ids);
 			if (tuple.S == nullptr) {
 				std::cout << "IO> Block " << block_id << " cannot be retrieved; ensure solution file and benchmark file match!" << std::endl;
 				exit(1);
@@ -1123,7 +1221,7 @@ void IO::parseCorblivarFile(FloorPlanner& fp, CorblivarCore& corb) {
 			tuple.S->layer = cur_layer;
 
 			// direction L
-			fp.IO_conf.solution_in >> dir;
+			in >> dir;
 			// parse direction; unsigned 
 			if (dir == static_cast<unsigned>(Direction::VERTICAL)) {
 				tuple.L = Direction::VERTICAL;
@@ -1133,13 +1231,13 @@ void IO::parseCorblivarFile(FloorPlanner& fp, CorblivarCore& corb) {
 			}
 
 			// T-junctions
-			fp.IO_conf.solution_in >> tuple.T;
+			in >> tuple.T;
 
 			// block width
-			fp.IO_conf.solution_in >> width;
+			in >> width;
 
 			// block height
-			fp.IO_conf.solution_in >> height;
+			in >> height;
 
 			// reshape block accordingly
 			tuple.S->bb.ur.x = tuple.S->bb.ll.x + width;
@@ -1151,7 +1249,7 @@ void IO::parseCorblivarFile(FloorPlanner& fp, CorblivarCore& corb) {
 			tuple.S->base_delay = TimingPowerAnalyser::baseDelay(height, width);
 
 			// drop ");"
-			fp.IO_conf.solution_in >> tmpstr;
+			in >> tmpstr;
 
 			// sanity check for same number of dies
 			if (cur_layer > fp.getLayers() - 1) {
@@ -1171,10 +1269,7 @@ void IO::parseCorblivarFile(FloorPlanner& fp, CorblivarCore& corb) {
 		exit(1);
 	}
 
-	if (fp.logMed()) {
-		std::cout << "IO> ";
-		std::cout << "Done; parsed " << tuples << " tuples" << std::endl << std::endl;
-	}
+	return tuples;
 }
 
 /// parse alignment-requests file
@@ -1250,7 +1345,7 @@ void IO::parseAlignmentRequests(FloorPlanner& fp, std::vector<CorblivarAlignment
 		al_in >> block_id;
 
 		// find related block
-		b1 = Block::findBlock(block_id, fp.blocks);
+		b1 = Block::findBlock(block_id, fp.blocks, fp.blocks_ids);
 		// no parsed block found
 		if (b1 == nullptr) {
 
@@ -1270,7 +1365,7 @@ void IO::parseAlignmentRequests(FloorPlanner& fp, std::vector<CorblivarAlignment
 		al_in >> block_id;
 
 		// find related block
-		b2 = Block::findBlock(block_id, fp.blocks);
+		b2 = Block::findBlock(block_id, fp.blocks, fp.blocks_ids);
 		// no parsed block found
 		if (b2 == nullptr) {
 
@@ -1388,25 +1483,190 @@ void IO::parseAlignmentRequests(FloorPlanner& fp, std::vector<CorblivarAlignment
 
 /// parse blocks file
 void IO::parseBlocks(FloorPlanner& fp) {
-	std::ifstream blocks_in, pins_in, power_in;
-	std::string tmpstr;
 	double power = 0.0;
 	double blocks_max_area = 0.0, blocks_avg_area = 0.0;
 	int soft_blocks = 0;
 	double blocks_outline_ratio;
-	std::string id;
-	int to_parse_soft_blocks, to_parse_hard_blocks, to_parse_terminals;
 	bool floorplacement;
-	unsigned numerical_id;
-	double GT_fp_height, GT_fp_width;
-	bool GT_soft_blocks;
-	bool GT_terminals;
+	IO::BenchmarkParameters parameters;
 
 	if (fp.logMed()) {
 		std::cout << "IO> ";
 		std::cout << "Parsing blocks..." << std::endl;
 	}
 
+	// reset blocks
+	fp.IC.blocks_area = 0.0;
+	fp.blocks.clear();
+	// reset terminals
+	fp.terminals.clear();
+
+	// reset blocks power statistics
+	fp.power_stats.max = fp.power_stats.range = fp.power_stats.avg = 0.0;
+	fp.power_stats.min = -1;
+
+	// load blocks and terminal pins from benchmark image, if available and valid;
+	// otherwise parse benchmark files
+	if (!fp.IO_conf.benchmark_image || !IO::readBenchmarkImageBlocks(fp, parameters)) {
+		IO::parseBlocksFiles(fp, parameters);
+	}
+
+	// apply non-zero outlines given in GATech floorplan file
+	if (fp.IO_conf.GT_benchmark && parameters.GT_fp_width != 0 && parameters.GT_fp_height != 0) {
+
+		fp.layoutOp.parameters.outline.x = fp.IC.outline_x = parameters.GT_fp_width;
+		fp.layoutOp.parameters.outline.y = fp.IC.outline_y = parameters.GT_fp_height;
+
+		// update aspect ratio and area
+		fp.IC.die_AR = fp.IC.outline_x / fp.IC.outline_y;
+		fp.IC.die_area = fp.IC.outline_x * fp.IC.outline_y;
+		fp.IC.stack_area = fp.IC.die_area * fp.IC.layers;
+
+		std::cout << "IO> Chip outline updated from GATech floorplan file:" << std::endl;
+		std::cout << "IO>  Chip -- Fixed die outline (width, x-dimension) [um]: " << fp.IC.outline_x << std::endl;
+		std::cout << "IO>  Chip -- Fixed die outline (height, y-dimension) [um]: " << fp.IC.outline_y << std::endl;
+	}
+
+	for (Block& block : fp.blocks) {
+
+		// copy the global power and delay scaling factors along with the
+		// voltages; they are required for dynamic calculation of power_density(),
+		// delay() and voltage()
+		block.voltages_power_factors = fp.voltageAssignment.parameters.voltages_power_factors;
+		block.voltages_delay_factors = fp.voltageAssignment.parameters.voltages_delay_factors;
+		block.voltages = fp.voltageAssignment.parameters.voltages;
+
+		// init feasible voltages with highest possible voltage
+		block.resetVoltageAssignment();
+
+		// calculate the base delay; according to [Lin10]
+		block.base_delay = TimingPowerAnalyser::baseDelay(block.bb.h, block.bb.w);
+
+		// track block power statistics
+		power += block.power();
+		fp.power_stats.max = std::max(fp.power_stats.max, block.power_density());
+		if (fp.power_stats.min == -1) {
+			fp.power_stats.min = block.power_density();
+		}
+		fp.power_stats.min = std::min(fp.power_stats.min, block.power_density());
+		fp.power_stats.avg += block.power_density();
+
+		// memorize summed blocks area and largest block, needs to fit into die
+		fp.IC.blocks_area += block.bb.area;
+		blocks_max_area = std::max(blocks_max_area, block.bb.area);
+
+		if (block.soft) {
+			soft_blocks++;
+		}
+	}
+
+	// init symbol tables for blocks and terminals; used for parsing of nets, alignment requests, etc.
+	Block::initIds(fp.blocks, fp.blocks_ids);
+	Block::initIds(fp.terminals, fp.terminals_ids);
+
+	// determine deadspace amount for whole stack, now that the occupied blocks area
+	// is known
+	fp.IC.stack_deadspace = fp.IC.stack_area - fp.IC.blocks_area;
+
+	// determine if floorplacement case, i.e., some very large blocks exist
+	blocks_avg_area = fp.IC.blocks_area / fp.blocks.size();
+	floorplacement = false;
+	for (Block& block : fp.blocks) {
+
+		if (block.bb.area >= FloorPlanner::FP_AREA_RATIO_LIMIT * blocks_avg_area) {
+
+			floorplacement = true;
+			// also mark block as floorplacement instance
+			block.floorplacement = true;
+		}
+	}
+	// update config parameter, i.e., deactivate floorplacement if not required
+	fp.layoutOp.parameters.floorplacement &= floorplacement;
+
+	// determine block power statistics
+	fp.power_stats.avg /= fp.blocks.size();
+	fp.power_stats.range = fp.power_stats.max - fp.power_stats.min;
+
+	// scale terminal pins
+	fp.scaleTerminalPins(Point(fp.IC.outline_x, fp.IC.outline_y));
+
+	// sanity check of fixed outline
+	blocks_outline_ratio = fp.IC.blocks_area / fp.IC.stack_area;
+	if (blocks_outline_ratio > 1.0) {
+		std::cout << "IO>  Chip too small; consider increasing the die outline or layers count" << std::endl;
+		std::cout << "IO>  Summed Blocks/dies area ratio: " << blocks_outline_ratio << std::endl;
+		exit(1);
+	}
+	// sanity check for largest block
+	if (blocks_max_area > fp.IC.die_area) {
+		std::cout << "IO>  Die outline too small; consider increasing it" << std::endl;
+		std::cout << "IO>  Largest-block/die area ratio: " << blocks_max_area / fp.IC.die_area << std::endl;
+		exit(1);
+	}
+
+	// sanity check for parsed blocks
+	if (parameters.to_parse_soft_blocks != -1 && parameters.to_parse_hard_blocks != -1) {
+		if (fp.blocks.size() != static_cast<unsigned>(parameters.to_parse_soft_blocks + parameters.to_parse_hard_blocks)) {
+			std::cout << "IO>  Not all given blocks could be parsed; consider checking the benchmark syntax!" << std::endl;
+			std::cout << "IO>   Parsed hard blocks: " << fp.blocks.size() - soft_blocks << ", expected hard blocks count: " << parameters.to_parse_hard_blocks << std::endl;
+			exit(1);
+		}
+	}
+
+	// sanity check for parsed terminals
+	if (parameters.to_parse_terminals != -1) {
+		if (fp.terminals.size() != static_cast<unsigned>(parameters.to_parse_terminals)) {
+			std::cout << "IO>  Not all given terminals could be parsed; consider checking the benchmark syntax!" << std::endl;
+			std::cout << "IO>   Parsed pins: " << fp.terminals.size() << ", expected pins count: " << parameters.to_parse_terminals << std::endl;
+			exit(1);
+		}
+	}
+
+	// logging
+	if (fp.logMed()) {
+		std::cout << "IO> ";
+		std::cout << "Done; " << fp.blocks.size() << " blocks read in, " << fp.terminals.size() << " terminal pins read in" << std::endl;
+		std::cout << "IO>  Soft blocks: " << soft_blocks << ", hard blocks: " << fp.blocks.size() - soft_blocks << std::endl;
+
+		// floorplacement
+		std::cout << "IO>  Largest-block / Average-block area ratio: " << blocks_max_area / blocks_avg_area << ", to be handled as floorplacement: " << floorplacement << std::endl;
+		if (!fp.layoutOp.parameters.floorplacement && floorplacement) {
+			std::cout << "IO>   Note: floorplacement is ignored since it's deactivated" << std::endl;
+		}
+
+		// blocks power
+		std::cout << "IO>  Summed blocks power [W]: " << power;
+		if (power != 0.0) {
+			std::cout << "; min power density [uW/um^2]: " << fp.power_stats.min;
+			std::cout << ", max power density [uW/um^2]: " << fp.power_stats.max;
+			std::cout << ", avg power density [uW/um^2]: " << fp.power_stats.avg << std::endl;
+		}
+		else {
+			std::cout << std::endl;
+		}
+
+		// blocks area
+		std::cout << "IO>  Summed blocks area [cm^2]: " << fp.IC.blocks_area * 1.0e-8;
+		std::cout << "; single die area [cm^2]: " << fp.IC.die_area * 1.0e-8;
+		std::cout << "; summed blocks area / summed dies area: " << blocks_outline_ratio << std::endl;
+		std::cout << std::endl;
+	}
+}
+
+/// actual parsing of blocks and terminal pins from benchmark files
+void IO::parseBlocksFiles(FloorPlanner& fp, IO::BenchmarkParameters& parameters) {
+	std::ifstream blocks_in, pins_in, power_in;
+	std::string tmpstr;
+	std::string id;
+	unsigned numerical_id;
+	bool GT_soft_blocks;
+	bool GT_terminals;
+	// positions of tokens in pins file; for look-up of GSRC terminal pins
+	std::unordered_map<std::string, std::streampos> pins_positions;
+	bool pins_indexed = false;
+	// flag for any issues during parsing, like missing power values
+	bool parse_issues = false;
+
 	// open GT benchmark files
 	if (fp.IO_conf.GT_benchmark) {
 		blocks_in.open(fp.IO_conf.GT_fp_file.c_str());
@@ -1432,20 +1692,13 @@ void IO::parseBlocks(FloorPlanner& fp) {
 		}
 	}
 
-	// reset blocks
-	fp.IC.blocks_area = 0.0;
-	fp.blocks.clear();
-	// reset terminals
-	fp.terminals.clear();
-
-	// reset blocks power statistics
-	fp.power_stats.max = fp.power_stats.range = fp.power_stats.avg = 0.0;
-	fp.power_stats.min = -1;
-
 	// first block id shall be distinct from the dummy id
 	numerical_id = Block::DUMMY_NUM_ID;
 	numerical_id++;
 
+	// outline only given in GATech floorplan file
+	parameters.GT_fp_width = parameters.GT_fp_height = 0.0;
+
 	// initial parsing for GSRC benchmarks
 	//
 	if (!fp.IO_conf.GT_benchmark) {
@@ -1456,57 +1709,44 @@ void IO::parseBlocks(FloorPlanner& fp) {
 		// drop ":"
 		blocks_in >> tmpstr;
 		// memorize how many soft blocks to be parsed
-		blocks_in >> to_parse_soft_blocks;
+		blocks_in >> parameters.to_parse_soft_blocks;
 		// drop "NumHardRectilinearBlocks" and ":"
 		blocks_in >> tmpstr;
 		blocks_in >> tmpstr;
 		// memorize how many hard blocks to be parsed
-		blocks_in >> to_parse_hard_blocks;
+		blocks_in >> parameters.to_parse_hard_blocks;
 		// drop "NumTerminals" and ":"
 		blocks_in >> tmpstr;
 		blocks_in >> tmpstr;
 		// memorize how many terminal pins to be parsed
-		blocks_in >> to_parse_terminals;
+		blocks_in >> parameters.to_parse_terminals;
 	}
 	// initial parsing for GATech benchmarks
 	//
 	else {
 		// number of blocks and terminal (to be parsed) not given in the files
-		to_parse_soft_blocks = to_parse_hard_blocks = to_parse_terminals = -1;
+		parameters.to_parse_soft_blocks = parameters.to_parse_hard_blocks = parameters.to_parse_terminals = -1;
 
 		// drop header lines until floorplan  section to be parsed
 		GT_soft_blocks = false;
 		while (tmpstr != "*FLOORPLAN" && !blocks_in.eof())
 			blocks_in >> tmpstr;
 		// parse floorplan width
-		blocks_in >> GT_fp_width;
+		blocks_in >> parameters.GT_fp_width;
 		// parse floorplan height
-		blocks_in >> GT_fp_height;
+		blocks_in >> parameters.GT_fp_height;
 		// drop "*END"
 		blocks_in >> tmpstr;
-		
-		// apply non-zero outlines
-		if (GT_fp_width != 0 && GT_fp_height != 0) {
-
-			fp.layoutOp.parameters.outline.x = fp.IC.outline_x = GT_fp_width;
-			fp.layoutOp.parameters.outline.y = fp.IC.outline_y = GT_fp_height;
-
-			// update aspect ratio and area
-			fp.IC.die_AR = fp.IC.outline_x / fp.IC.outline_y;
-			fp.IC.die_area = fp.IC.outline_x * fp.IC.outline_y;
-			fp.IC.stack_area = fp.IC.die_area * fp.IC.layers;
-
-			std::cout << "IO> Chip outline updated from GATech floorplan file:" << std::endl;
-			std::cout << "IO>  Chip -- Fixed die outline (width, x-dimension) [um]: " << fp.IC.outline_x << std::endl;
-			std::cout << "IO>  Chip -- Fixed die outline (height, y-dimension) [um]: " << fp.IC.outline_y << std::endl;
-		}
 	}
 
 	// parse blocks and pins
 	while (!blocks_in.eof()) {
 
-		// parse block identifier
-		blocks_in >> id;
+		// parse block identifier; we may have reached eof just now, i.e., after
+		// parsing the last block/pin
+		if (!(blocks_in >> id)) {
+			break;
+		}
 
 		// init block / pin
 		Block new_block = Block(id, numerical_id);
@@ -1582,18 +1822,33 @@ void IO::parseBlocks(FloorPlanner& fp) {
 		// GSRC terminal pins: stored separately, parse from pins file
 		if (!fp.IO_conf.GT_benchmark && tmpstr == "terminal") {
 
-			// parse pins file for related coordinates
-			while (tmpstr != id && !pins_in.eof()) {
-				pins_in >> tmpstr;
+			// index all tokens of pins file once, i.e., memorize the stream
+			// position following the first occurrence of each token
+			if (!pins_indexed) {
+
+				while (pins_in >> tmpstr) {
+					pins_positions.emplace(tmpstr, pins_in.tellg());
+				}
+				pins_indexed = true;
 			}
 
+			// look up pins file for related coordinates
+			auto pin_position = pins_positions.find(id);
+
 			// pin cannot be found; log
-			if (pins_in.eof() && fp.logMin()) {
-				std::cout << "IO>  Coordinates for pin \"" << id << "\" cannot be retrieved, consider checking the pins file!" << std::endl;
+			if (pin_position == pins_positions.end()) {
+				parse_issues = true;
+
+				if (fp.logMin()) {
+					std::cout << "IO>  Coordinates for pin \"" << id << "\" cannot be retrieved, consider checking the pins file!" << std::endl;
+				}
 			}
 			// initially, parse coordinates of found pin; they will be scaled
 			// after parsing whole blocks file
 			else {
+				pins_in.clear();
+				pins_in.seekg(pin_position->second);
+
 				pins_in >> new_pin.bb.ll.x;
 				pins_in >> new_pin.bb.ll.y;
 			}
@@ -1601,10 +1856,6 @@ void IO::parseBlocks(FloorPlanner& fp) {
 			// store pin
 			fp.terminals.push_back(new_pin);
 
-			// reset pins file stream for next search
-			pins_in.clear() ;
-			pins_in.seekg(0, pins_in.beg);
-
 			// skip further block related handling
 			continue;
 		}
@@ -1687,9 +1938,6 @@ void IO::parseBlocks(FloorPlanner& fp) {
 			// init block dimensions randomly
 			new_block.shapeRandomlyByAR();
 
-			// memorize soft blocks count
-			soft_blocks++;
-
 			// also increment numerical id for next block
 			numerical_id++;
 		}
@@ -1724,6 +1972,8 @@ void IO::parseBlocks(FloorPlanner& fp) {
 					new_block.power_density_unscaled_back = new_block.power_density_unscaled;
 				}
 				else {
+					parse_issues = true;
+
 					if (fp.logMin()) {
 						std::cout << "IO>  Some blocks have no power value assigned, consider checking the power density file!" << std::endl;
 					}
@@ -1739,6 +1989,9 @@ void IO::parseBlocks(FloorPlanner& fp) {
 				}
 
 				// related line cannot be found; log
+				if (power_in.eof()) {
+					parse_issues = true;
+				}
 				if (power_in.eof() && fp.logMin()) {
 					std::cout << "IO>  Power value for block \"" << id << "\" cannot be retrieved, consider checking the power file!" << std::endl;
 				}
@@ -1768,32 +2021,6 @@ void IO::parseBlocks(FloorPlanner& fp) {
 			}
 		}
 
-		// copy the global power and delay scaling factors along with the
-		// voltages; they are required for dynamic calculation of power_density(),
-		// delay() and voltage()
-		new_block.voltages_power_factors = fp.voltageAssignment.parameters.voltages_power_factors;
-		new_block.voltages_delay_factors = fp.voltageAssignment.parameters.voltages_delay_factors;
-		new_block.voltages = fp.voltageAssignment.parameters.voltages;
-
-		// init feasible voltages with highest possible voltage
-		new_block.resetVoltageAssignment();
-
-		// calculate the base delay; according to [Lin10]
-		new_block.base_delay = TimingPowerAnalyser::baseDelay(new_block.bb.h, new_block.bb.w);
-
-		// track block power statistics
-		power += new_block.power();
-		fp.power_stats.max = std::max(fp.power_stats.max, new_block.power_density());
-		if (fp.power_stats.min == -1) {
-			fp.power_stats.min = new_block.power_density();
-		}
-		fp.power_stats.min = std::min(fp.power_stats.min, new_block.power_density());
-		fp.power_stats.avg += new_block.power_density();
-
-		// memorize summed blocks area and largest block, needs to fit into die
-		fp.IC.blocks_area += new_block.bb.area;
-		blocks_max_area = std::max(blocks_max_area, new_block.bb.area);
-
 		// store block
 		fp.blocks.push_back(std::move(new_block));
 	}
@@ -1803,97 +2030,75 @@ void IO::parseBlocks(FloorPlanner& fp) {
 	power_in.close();
 	pins_in.close();
 
-	// determine deadspace amount for whole stack, now that the occupied blocks area
-	// is known
-	fp.IC.stack_deadspace = fp.IC.stack_area - fp.IC.blocks_area;
+	// memorize parsed data in benchmark image, for subsequent runs; only if the
+	// benchmark could be parsed w/o issues, such that related logs are not hidden
+	// in subsequent runs
+	if (fp.IO_conf.benchmark_image) {
+		if (parse_issues) {
+			fp.IO_conf.benchmark_image_valid = false;
+		}
+		else {
+			IO::writeBenchmarkImageBlocks(fp, parameters);
+		}
+	}
+}
 
-	// determine if floorplacement case, i.e., some very large blocks exist
-	blocks_avg_area = fp.IC.blocks_area / fp.blocks.size();
-	floorplacement = false;
-	for (Block& block : fp.blocks) {
+/// parse nets file
+void IO::parseNets(FloorPlanner& fp) {
+	IO::BenchmarkParameters parameters;
 
-		if (block.bb.area >= FloorPlanner::FP_AREA_RATIO_LIMIT * blocks_avg_area) {
-
-			floorplacement = true;
-			// also mark block as floorplacement instance
-			block.floorplacement = true;
-		}
+	if (fp.logMed()) {
+		std::cout << "IO> ";
+		std::cout << "Parsing nets..." << std::endl;
 	}
-	// update config parameter, i.e., deactivate floorplacement if not required
-	fp.layoutOp.parameters.floorplacement &= floorplacement;
 
-	// determine block power statistics
-	fp.power_stats.avg /= fp.blocks.size();
-	fp.power_stats.range = fp.power_stats.max - fp.power_stats.min;
-
-	// scale terminal pins
-	fp.scaleTerminalPins(Point(fp.IC.outline_x, fp.IC.outline_y));
+	// reset nets
+	fp.nets.clear();
 
-	// sanity check of fixed outline
-	blocks_outline_ratio = fp.IC.blocks_area / fp.IC.stack_area;
-	if (blocks_outline_ratio > 1.0) {
-		std::cout << "IO>  Chip too small; consider increasing the die outline or layers count" << std::endl;
-		std::cout << "IO>  Summed Blocks/dies area ratio: " << blocks_outline_ratio << std::endl;
-		exit(1);
-	}
-	// sanity check for largest block
-	if (blocks_max_area > fp.IC.die_area) {
-		std::cout << "IO>  Die outline too small; consider increasing it" << std::endl;
-		std::cout << "IO>  Largest-block/die area ratio: " << blocks_max_area / fp.IC.die_area << std::endl;
-		exit(1);
+	// load nets from benchmark image, if available and valid; otherwise parse
+	// benchmark files
+	if (!fp.IO_conf.benchmark_image || !IO::readBenchmarkImageNets(fp, parameters)) {
+		IO::parseNetsFiles(fp, parameters);
 	}
 
-	// sanity check for parsed blocks
-	if (to_parse_soft_blocks != -1 && to_parse_hard_blocks != -1) {
-		if (fp.blocks.size() != static_cast<unsigned>(to_parse_soft_blocks + to_parse_hard_blocks)) {
-			std::cout << "IO>  Not all given blocks could be parsed; consider checking the benchmark syntax!" << std::endl;
-			std::cout << "IO>   Parsed hard blocks: " << fp.blocks.size() - soft_blocks << ", expected hard blocks count: " << to_parse_hard_blocks << std::endl;
-			exit(1);
+	if (IO::DBG) {
+		for (Net const& n : fp.nets) {
+			std::cout << "DBG_IO> ";
+			std::cout << "net " << n.id << std::endl;
+
+			for (Block const* block : n.blocks) {
+				std::cout << "DBG_IO> ";
+				std::cout << " block " << block->id << std::endl;
+			}
+
+			for (Pin const* pin : n.terminals) {
+				std::cout << "DBG_IO> ";
+				std::cout << " pin " << pin->id << std::endl;
+			}
 		}
 	}
 
-	// sanity check for parsed terminals
-	if (to_parse_terminals != -1) {
-		if (fp.terminals.size() != static_cast<unsigned>(to_parse_terminals)) {
-			std::cout << "IO>  Not all given terminals could be parsed; consider checking the benchmark syntax!" << std::endl;
-			std::cout << "IO>   Parsed pins: " << fp.terminals.size() << ", expected pins count: " << to_parse_terminals << std::endl;
+	// GSRC, sanity check for parsed nets
+	//
+	if (parameters.to_parse_nets != -1) {
+		if (fp.nets.size() != static_cast<unsigned>(parameters.to_parse_nets)) {
+			std::cout << "IO>  Not all given nets could be parsed; consider checking the benchmark format, should comply w/ GSRC Bookshelf" << std::endl;
+			std::cout << "IO>   Parsed nets: " << fp.nets.size() << ", expected nets count: " << parameters.to_parse_nets << std::endl;
 			exit(1);
 		}
 	}
 
-	// logging
 	if (fp.logMed()) {
-		std::cout << "IO> ";
-		std::cout << "Done; " << fp.blocks.size() << " blocks read in, " << fp.terminals.size() << " terminal pins read in" << std::endl;
-		std::cout << "IO>  Soft blocks: " << soft_blocks << ", hard blocks: " << fp.blocks.size() - soft_blocks << std::endl;
-
-		// floorplacement
-		std::cout << "IO>  Largest-block / Average-block area ratio: " << blocks_max_area / blocks_avg_area << ", to be handled as floorplacement: " << floorplacement << std::endl;
-		if (!fp.layoutOp.parameters.floorplacement && floorplacement) {
-			std::cout << "IO>   Note: floorplacement is ignored since it's deactivated" << std::endl;
-		}
-
-		// blocks power
-		std::cout << "IO>  Summed blocks power [W]: " << power;
-		if (power != 0.0) {
-			std::cout << "; min power density [uW/um^2]: " << fp.power_stats.min;
-			std::cout << ", max power density [uW/um^2]: " << fp.power_stats.max;
-			std::cout << ", avg power density [uW/um^2]: " << fp.power_stats.avg << std::endl;
-		}
-		else {
-			std::cout << std::endl;
-		}
-
-		// blocks area
-		std::cout << "IO>  Summed blocks area [cm^2]: " << fp.IC.blocks_area * 1.0e-8;
-		std::cout << "; single die area [cm^2]: " << fp.IC.die_area * 1.0e-8;
-		std::cout << "; summed blocks area / summed dies area: " << blocks_outline_ratio << std::endl;
+		std::cout << "IO> Done; " << fp.nets.size() << " nets read in" << std::endl;
+		std::cout << "IO>  Avg net degree: " << static_cast<double>(parameters.count_degree) / fp.nets.size() << std::endl;
+		std::cout << "IO>  Input nets: " << parameters.count_input << "; output nets: " << parameters.count_output << std::endl;
 		std::cout << std::endl;
 	}
+
 }
 
-/// parse nets file
-void IO::parseNets(FloorPlanner& fp) {
+/// actual parsing of nets from benchmark files
+void IO::parseNetsFiles(FloorPlanner& fp, IO::BenchmarkParameters& parameters) {
 	std::ifstream in;
 	std::string tmpstr;
 	int i, net_degree;
@@ -1902,17 +2107,9 @@ void IO::parseNets(FloorPlanner& fp) {
 	Pin const* pin;
 	int id_num;
 	std::string id;
-	bool block_not_found, pin_not_found;
-	int to_parse_nets;
-	unsigned count_input, count_output, count_degree;
-
-	if (fp.logMed()) {
-		std::cout << "IO> ";
-		std::cout << "Parsing nets..." << std::endl;
-	}
-
-	// reset nets
-	fp.nets.clear();
+	bool block_not_found = false, pin_not_found = false;
+	// flag for any issues during parsing, like blocks not to be found
+	bool parse_issues = false;
 
 	// open nets file
 	//
@@ -1946,15 +2143,15 @@ void IO::parseNets(FloorPlanner& fp) {
 	//
 	// GSRC
 	if (!fp.IO_conf.GT_benchmark) {
-		in >> to_parse_nets;
+		in >> parameters.to_parse_nets;
 	}
 	// GATech, info not given
 	else {
-		to_parse_nets = -1;
+		parameters.to_parse_nets = -1;
 	}
 
 	// init counter
-	count_input = count_output = count_degree = 0;
+	parameters.count_input = parameters.count_output = parameters.count_degree = 0;
 	id_num = 0;
 
 	// parse nets
@@ -2011,7 +2208,7 @@ void IO::parseNets(FloorPlanner& fp) {
 		// parse net degree
 		in >> net_degree;
 
-		count_degree += net_degree;
+		parameters.count_degree += net_degree;
 
 		// due to some empty lines at the end, we may have reached eof just now
 		if (in.eof()) {
@@ -2027,7 +2224,7 @@ void IO::parseNets(FloorPlanner& fp) {
 			in >> net_block;
 
 			// try to interpret as terminal pin
-			pin = Pin::findPin(net_block, fp.terminals);
+			pin = Pin::findPin(net_block, fp.terminals, fp.terminals_ids);
 
 			if (pin != nullptr) {
 
@@ -2070,9 +2267,9 @@ void IO::parseNets(FloorPlanner& fp) {
 
 				// update net counter
 				if (new_net.inputNet)
-					count_input++;
+					parameters.count_input++;
 				if (new_net.outputNet)
-					count_output++;
+					parameters.count_output++;
 			}
 			else {
 				// pin not found
@@ -2082,7 +2279,7 @@ void IO::parseNets(FloorPlanner& fp) {
 			// try to interpret as regular block 
 			if (pin_not_found) {
 
-				block = Block::findBlock(net_block, fp.blocks);
+				block = Block::findBlock(net_block, fp.blocks, fp.blocks_ids);
 
 				if (block != nullptr) {
 
@@ -2115,6 +2312,9 @@ void IO::parseNets(FloorPlanner& fp) {
 			}
 
 			// log pin parsing failure
+			if (block_not_found && pin_not_found) {
+				parse_issues = true;
+			}
 			if (fp.logMin()) {
 				if (block_not_found && !pin_not_found) {
 					std::cout << "IO>  Net " << new_net.id << "'s block \"" << net_block << "\"";
@@ -2142,40 +2342,503 @@ void IO::parseNets(FloorPlanner& fp) {
 	// close nets file
 	in.close();
 
-	if (IO::DBG) {
-		for (Net const& n : fp.nets) {
-			std::cout << "DBG_IO> ";
-			std::cout << "net " << n.id << std::endl;
+	// memorize parsed data in benchmark image, for subsequent runs; only if the
+	// nets could be parsed w/o issues, such that related logs are not hidden in
+	// subsequent runs
+	if (fp.IO_conf.benchmark_image && !parse_issues) {
+		IO::writeBenchmarkImageNets(fp, parameters);
+	}
+}
 
-			for (Block const* block : n.blocks) {
-				std::cout << "DBG_IO> ";
-				std::cout << " block " << block->id << std::endl;
+/// FNV-1a hash over the contents of all benchmark files, along w/ parameters which are applied to the data during parsing, i.e., scaling factors
+unsigned long long IO::hashBenchmark(FloorPlanner const& fp) {
+	std::vector<std::string> files;
+	std::ifstream in;
+	std::array<char, 65536> buffer;
+	unsigned long long hash;
+
+	// FNV-1a parameters
+	static constexpr unsigned long long FNV_OFFSET_BASIS = 14695981039346656037ULL;
+	static constexpr unsigned long long FNV_PRIME = 1099511628211ULL;
+
+	auto hashBytes = [&](char const* data, size_t const& size) {
+		for (size_t i = 0; i < size; i++) {
+			hash ^= static_cast<unsigned char>(data[i]);
+			hash *= FNV_PRIME;
+		}
+	};
+
+	hash = FNV_OFFSET_BASIS;
+
+	// parameters
+	hashBytes(reinterpret_cast<char const*>(&IO::BENCHMARK_IMAGE_VERSION), sizeof(IO::BENCHMARK_IMAGE_VERSION));
+	hashBytes(reinterpret_cast<char const*>(&fp.IO_conf.GT_benchmark), sizeof(fp.IO_conf.GT_benchmark));
+	hashBytes(reinterpret_cast<char const*>(&fp.IO_conf.power_density_file_avail), sizeof(fp.IO_conf.power_density_file_avail));
+	hashBytes(reinterpret_cast<char const*>(&fp.IC.blocks_scale), sizeof(fp.IC.blocks_scale));
+	hashBytes(reinterpret_cast<char const*>(&fp.IC.power_scale), sizeof(fp.IC.power_scale));
+
+	// benchmark files
+	if (fp.IO_conf.GT_benchmark) {
+		files = {fp.IO_conf.GT_fp_file, fp.IO_conf.GT_power_file};
+	}
+	else {
+		files = {fp.IO_conf.blocks_file, fp.IO_conf.pins_file, fp.IO_conf.power_density_file, fp.IO_conf.nets_file};
+	}
+
+	for (std::string const& file : files) {
+
+		in.open(file.c_str(), std::ios::binary);
+
+		// also consider missing files, in order to distinguish them from empty files
+		if (!in.good()) {
+			hashBytes("\0", 1);
+		}
+
+		while (in.read(buffer.data(), buffer.size()) || in.gcount() > 0) {
+			hashBytes(buffer.data(), in.gcount());
+		}
+
+		in.close();
+		in.clear();
+
+		// separate files
+		hashBytes("\n", 1);
+	}
+
+	return hash;
+}
+
+/// layout of benchmark images: header (magic string, version, hash of benchmark), size of blocks section, blocks section, size of nets section, nets section;
+/// all values are stored in native binary representation, strings are stored w/ their length
+bool IO::readBenchmarkImageBlocks(FloorPlanner& fp, IO::BenchmarkParameters& parameters) {
+	std::ifstream in;
+	std::stringstream image;
+	std::string data;
+	size_t pos;
+	unsigned long long hash, section_size;
+	int version;
+	unsigned count;
+	unsigned char flag;
+
+	fp.IO_conf.benchmark_image_hash = IO::hashBenchmark(fp);
+	fp.IO_conf.benchmark_image_valid = false;
+	fp.IO_conf.benchmark_image_data.clear();
+
+	in.open(fp.IO_conf.benchmark_image_file.c_str(), std::ios::binary);
+	if (!in.good()) {
+		return false;
+	}
+	image << in.rdbuf();
+	in.close();
+	data = image.str();
+
+	pos = 0;
+	auto read = [&](void* dest, size_t const& size) {
+		if (pos + size > data.size()) {
+			return false;
+		}
+		std::copy(data.begin() + pos, data.begin() + pos + size, static_cast<char*>(dest));
+		pos += size;
+		return true;
+	};
+	auto readString = [&](std::string& str) {
+		unsigned length;
+		if (!read(&length, sizeof(length)) || pos + length > data.size()) {
+			return false;
+		}
+		str.assign(data, pos, length);
+		pos += length;
+		return true;
+	};
+
+	// header
+	if (data.compare(0, IO::BENCHMARK_IMAGE_MAGIC.size(), IO::BENCHMARK_IMAGE_MAGIC) != 0) {
+		return false;
+	}
+	pos = IO::BENCHMARK_IMAGE_MAGIC.size();
+	if (!read(&version, sizeof(version)) || version != IO::BENCHMARK_IMAGE_VERSION) {
+		return false;
+	}
+	if (!read(&hash, sizeof(hash)) || hash != fp.IO_conf.benchmark_image_hash) {
+		return false;
+	}
+	if (!read(&section_size, sizeof(section_size)) || pos + section_size > data.size()) {
+		return false;
+	}
+
+	// blocks section
+	if (!read(&parameters.to_parse_soft_blocks, sizeof(parameters.to_parse_soft_blocks)) ||
+			!read(&parameters.to_parse_hard_blocks, sizeof(parameters.to_parse_hard_blocks)) ||
+			!read(&parameters.to_parse_terminals, sizeof(parameters.to_parse_terminals)) ||
+			!read(&parameters.GT_fp_width, sizeof(parameters.GT_fp_width)) ||
+			!read(&parameters.GT_fp_height, sizeof(parameters.GT_fp_height))) {
+		return false;
+	}
+
+	// blocks
+	if (!read(&count, sizeof(count))) {
+		return false;
+	}
+	fp.blocks.reserve(count);
+	for (unsigned b = 0; b < count; b++) {
+		std::string id;
+
+		if (!readString(id)) {
+			fp.blocks.clear();
+			return false;
+		}
+
+		Block new_block = Block(id, b);
+
+		if (!read(&flag, sizeof(flag)) ||
+				!read(&new_block.bb.w, sizeof(new_block.bb.w)) ||
+				!read(&new_block.bb.h, sizeof(new_block.bb.h)) ||
+				!read(&new_block.bb.area, sizeof(new_block.bb.area)) ||
+				!read(&new_block.AR.min, sizeof(new_block.AR.min)) ||
+				!read(&new_block.AR.max, sizeof(new_block.AR.max)) ||
+				!read(&new_block.power_density_unscaled, sizeof(new_block.power_density_unscaled)) ||
+				!read(&new_block.power_density_unscaled_back, sizeof(new_block.power_density_unscaled_back))) {
+			fp.blocks.clear();
+			return false;
+		}
+
+		// soft blocks are shaped randomly, as during parsing
+		if (flag) {
+			new_block.soft = true;
+			new_block.shapeRandomlyByAR();
+		}
+
+		fp.blocks.push_back(std::move(new_block));
+	}
+
+	// terminal pins
+	if (!read(&count, sizeof(count))) {
+		fp.blocks.clear();
+		return false;
+	}
+	fp.terminals.reserve(count);
+	for (unsigned p = 0; p < count; p++) {
+		std::string id;
+
+		if (!readString(id)) {
+			fp.blocks.clear();
+			fp.terminals.clear();
+			return false;
+		}
+
+		Pin new_pin = Pin(id);
+
+		if (!read(&new_pin.bb.ll.x, sizeof(new_pin.bb.ll.x)) ||
+				!read(&new_pin.bb.ll.y, sizeof(new_pin.bb.ll.y))) {
+			fp.blocks.clear();
+			fp.terminals.clear();
+			return false;
+		}
+
+		fp.terminals.push_back(std::move(new_pin));
+	}
+
+	// the validated image is kept, such that the nets section is read from the
+	// same data, w/o reading the file again
+	fp.IO_conf.benchmark_image_valid = true;
+	fp.IO_conf.benchmark_image_data = std::move(data);
+
+	if (fp.logMed()) {
+		std::cout << "IO>  Blocks and terminal pins loaded from benchmark image " << fp.IO_conf.benchmark_image_file << std::endl;
+	}
+
+	return true;
+}
+
+/// note that the terminal pins are expected to be not scaled yet
+void IO::writeBenchmarkImageBlocks(FloorPlanner& fp, IO::BenchmarkParameters const& parameters) {
+	std::stringstream section;
+	std::string data;
+	std::ofstream out;
+	std::string tmp_file;
+	unsigned long long section_size;
+	unsigned count;
+	unsigned char flag;
+
+	auto write = [&](void const* src, size_t const& size) {
+		section.write(static_cast<char const*>(src), size);
+	};
+	auto writeString = [&](std::string const& str) {
+		unsigned length = str.size();
+		write(&length, sizeof(length));
+		section.write(str.data(), length);
+	};
+
+	// blocks section
+	write(&parameters.to_parse_soft_blocks, sizeof(parameters.to_parse_soft_blocks));
+	write(&parameters.to_parse_hard_blocks, sizeof(parameters.to_parse_hard_blocks));
+	write(&parameters.to_parse_terminals, sizeof(parameters.to_parse_terminals));
+	write(&parameters.GT_fp_width, sizeof(parameters.GT_fp_width));
+	write(&parameters.GT_fp_height, sizeof(parameters.GT_fp_height));
+
+	count = fp.blocks.size();
+	write(&count, sizeof(count));
+	for (Block const& block : fp.blocks) {
+		flag = block.soft;
+
+		writeString(block.id);
+		write(&flag, sizeof(flag));
+		write(&block.bb.w, sizeof(block.bb.w));
+		write(&block.bb.h, sizeof(block.bb.h));
+		write(&block.bb.area, sizeof(block.bb.area));
+		write(&block.AR.min, sizeof(block.AR.min));
+		write(&block.AR.max, sizeof(block.AR.max));
+		write(&block.power_density_unscaled, sizeof(block.power_density_unscaled));
+		write(&block.power_density_unscaled_back, sizeof(block.power_density_unscaled_back));
+	}
+
+	count = fp.terminals.size();
+	write(&count, sizeof(count));
+	for (Pin const& pin : fp.terminals) {
+		writeString(pin.id);
+		write(&pin.bb.ll.x, sizeof(pin.bb.ll.x));
+		write(&pin.bb.ll.y, sizeof(pin.bb.ll.y));
+	}
+
+	data = section.str();
+	section_size = data.size();
+
+	// write image into temporary file first, and then rename it; avoids partially written images; the temporary file is unique for each process, since
+	// several processes may share the same working dir
+	tmp_file = fp.IO_conf.benchmark_image_file + "." + std::to_string(getpid()) + ".tmp";
+	out.open(tmp_file.c_str(), std::ios::binary | std::ios::trunc);
+	if (!out.good()) {
+		return;
+	}
+	out.write(IO::BENCHMARK_IMAGE_MAGIC.data(), IO::BENCHMARK_IMAGE_MAGIC.size());
+	out.write(reinterpret_cast<char const*>(&IO::BENCHMARK_IMAGE_VERSION), sizeof(IO::BENCHMARK_IMAGE_VERSION));
+	out.write(reinterpret_cast<char const*>(&fp.IO_conf.benchmark_image_hash), sizeof(fp.IO_conf.benchmark_image_hash));
+	out.write(reinterpret_cast<char const*>(&section_size), sizeof(section_size));
+	out.write(data.data(), data.size());
+	out.close();
+
+	if (out.good() && std::rename(tmp_file.c_str(), fp.IO_conf.benchmark_image_file.c_str()) == 0) {
+		fp.IO_conf.benchmark_image_valid = true;
+
+		// keep the written image, for appending the nets section
+		fp.IO_conf.benchmark_image_data = IO::BENCHMARK_IMAGE_MAGIC;
+		fp.IO_conf.benchmark_image_data.append(reinterpret_cast<char const*>(&IO::BENCHMARK_IMAGE_VERSION), sizeof(IO::BENCHMARK_IMAGE_VERSION));
+		fp.IO_conf.benchmark_image_data.append(reinterpret_cast<char const*>(&fp.IO_conf.benchmark_image_hash), sizeof(fp.IO_conf.benchmark_image_hash));
+		fp.IO_conf.benchmark_image_data.append(reinterpret_cast<char const*>(&section_size), sizeof(section_size));
+		fp.IO_conf.benchmark_image_data.append(data);
+	}
+	else {
+		std::remove(tmp_file.c_str());
+	}
+}
+
+/// note that the blocks section of the image has to be valid, i.e., has to be read or written just before; the nets section is read from the image data kept
+/// in memory, which has been validated along w/ the blocks section
+bool IO::readBenchmarkImageNets(FloorPlanner& fp, IO::BenchmarkParameters& parameters) {
+	size_t pos;
+	unsigned long long section_size;
+	unsigned count, members, index;
+	int source;
+	unsigned char flags;
+
+	if (!fp.IO_conf.benchmark_image_valid || fp.IO_conf.benchmark_image_data.empty()) {
+		return false;
+	}
+
+	std::string const& data = fp.IO_conf.benchmark_image_data;
+
+	pos = 0;
+	auto read = [&](void* dest, size_t const& size) {
+		if (pos + size > data.size()) {
+			return false;
+		}
+		std::copy(data.begin() + pos, data.begin() + pos + size, static_cast<char*>(dest));
+		pos += size;
+		return true;
+	};
+	auto readString = [&](std::string& str) {
+		unsigned length;
+		if (!read(&length, sizeof(length)) || pos + length > data.size()) {
+			return false;
+		}
+		str.assign(data, pos, length);
+		pos += length;
+		return true;
+	};
+	auto fail = [&]() {
+		fp.nets.clear();
+		return false;
+	};
+
+	// skip header and blocks section
+	pos = IO::BENCHMARK_IMAGE_MAGIC.size() + sizeof(IO::BENCHMARK_IMAGE_VERSION) + sizeof(fp.IO_conf.benchmark_image_hash);
+	if (!read(&section_size, sizeof(section_size))) {
+		return false;
+	}
+	pos += section_size;
+
+	// nets section
+	if (!read(&section_size, sizeof(section_size)) || pos + section_size > data.size()) {
+		return false;
+	}
+	if (!read(&parameters.to_parse_nets, sizeof(parameters.to_parse_nets)) ||
+			!read(&parameters.count_input, sizeof(parameters.count_input)) ||
+			!read(&parameters.count_output, sizeof(parameters.count_output)) ||
+			!read(&parameters.count_degree, sizeof(parameters.count_degree))) {
+		return false;
+	}
+
+	if (!read(&count, sizeof(count))) {
+		return false;
+	}
+	fp.nets.reserve(count);
+	for (unsigned n = 0; n < count; n++) {
+		std::string id;
+
+		if (!readString(id) || !read(&flags, sizeof(flags))) {
+			return fail();
+		}
+
+		Net new_net = Net(id);
+		new_net.hasExternalPin = flags & 1;
+		new_net.inputNet = flags & 2;
+		new_net.outputNet = flags & 4;
+
+		// blocks, given by their numerical ids/indices
+		if (!read(&members, sizeof(members))) {
+			return fail();
+		}
+		for (unsigned m = 0; m < members; m++) {
+			if (!read(&index, sizeof(index)) || index >= fp.blocks.size()) {
+				return fail();
 			}
+			new_net.blocks.push_back(&fp.blocks[index]);
+		}
 
-			for (Pin const* pin : n.terminals) {
-				std::cout << "DBG_IO> ";
-				std::cout << " pin " << pin->id << std::endl;
+		// terminal pins, given by their indices
+		if (!read(&members, sizeof(members))) {
+			return fail();
+		}
+		for (unsigned m = 0; m < members; m++) {
+			if (!read(&index, sizeof(index)) || index >= fp.terminals.size()) {
+				return fail();
 			}
+			new_net.terminals.push_back(&fp.terminals[index]);
 		}
-	}
 
-	// GSRC, sanity check for parsed nets
-	//
-	if (to_parse_nets != -1) {
-		if (fp.nets.size() != static_cast<unsigned>(to_parse_nets)) {
-			std::cout << "IO>  Not all given nets could be parsed; consider checking the benchmark format, should comply w/ GSRC Bookshelf" << std::endl;
-			std::cout << "IO>   Parsed nets: " << fp.nets.size() << ", expected nets count: " << to_parse_nets << std::endl;
-			exit(1);
+		// source, if any
+		if (!read(&source, sizeof(source)) || source >= static_cast<int>(fp.blocks.size())) {
+			return fail();
+		}
+		if (source >= 0) {
+			new_net.source = &fp.blocks[source];
 		}
+
+		fp.nets.push_back(std::move(new_net));
 	}
 
+	// image data is not required anymore
+	fp.IO_conf.benchmark_image_data.clear();
+	fp.IO_conf.benchmark_image_data.shrink_to_fit();
+
 	if (fp.logMed()) {
-		std::cout << "IO> Done; " << fp.nets.size() << " nets read in" << std::endl;
-		std::cout << "IO>  Avg net degree: " << static_cast<double>(count_degree) / fp.nets.size() << std::endl;
-		std::cout << "IO>  Input nets: " << count_input << "; output nets: " << count_output << std::endl;
-		std::cout << std::endl;
+		std::cout << "IO>  Nets loaded from benchmark image " << fp.IO_conf.benchmark_image_file << std::endl;
+	}
+
+	return true;
+}
+
+/// the nets section is appended to the valid blocks section of the image
+void IO::writeBenchmarkImageNets(FloorPlanner& fp, IO::BenchmarkParameters const& parameters) {
+	std::stringstream section;
+	std::string data;
+	std::ofstream out;
+	std::string tmp_file;
+	unsigned long long section_size;
+	size_t blocks_section_end;
+	unsigned count, index;
+	int source;
+	unsigned char flags;
+
+	if (!fp.IO_conf.benchmark_image_valid) {
+		return;
+	}
+
+	auto write = [&](void const* src, size_t const& size) {
+		section.write(static_cast<char const*>(src), size);
+	};
+	auto writeString = [&](std::string const& str) {
+		unsigned length = str.size();
+		write(&length, sizeof(length));
+		section.write(str.data(), length);
+	};
+
+	// image w/ blocks section, as read or written before; the file is not read
+	// again, since it may have been replaced by another run in the meantime
+	data = std::move(fp.IO_conf.benchmark_image_data);
+	fp.IO_conf.benchmark_image_data.clear();
+
+	// determine end of blocks section, drop any data beyond
+	blocks_section_end = IO::BENCHMARK_IMAGE_MAGIC.size() + sizeof(IO::BENCHMARK_IMAGE_VERSION) + sizeof(fp.IO_conf.benchmark_image_hash);
+	if (blocks_section_end + sizeof(section_size) > data.size()) {
+		return;
+	}
+	std::copy(data.begin() + blocks_section_end, data.begin() + blocks_section_end + sizeof(section_size), reinterpret_cast<char*>(&section_size));
+	blocks_section_end += sizeof(section_size) + section_size;
+	if (blocks_section_end > data.size()) {
+		return;
+	}
+	data.resize(blocks_section_end);
+
+	// nets section
+	write(&parameters.to_parse_nets, sizeof(parameters.to_parse_nets));
+	write(&parameters.count_input, sizeof(parameters.count_input));
+	write(&parameters.count_output, sizeof(parameters.count_output));
+	write(&parameters.count_degree, sizeof(parameters.count_degree));
+
+	count = fp.nets.size();
+	write(&count, sizeof(count));
+	for (Net const& net : fp.nets) {
+		flags = (net.hasExternalPin ? 1 : 0) | (net.inputNet ? 2 : 0) | (net.outputNet ? 4 : 0);
+
+		writeString(net.id);
+		write(&flags, sizeof(flags));
+
+		count = net.blocks.size();
+		write(&count, sizeof(count));
+		for (Block const* block : net.blocks) {
+			index = block->numerical_id;
+			write(&index, sizeof(index));
+		}
+
+		count = net.terminals.size();
+		write(&count, sizeof(count));
+		for (Pin const* pin : net.terminals) {
+			index = pin - fp.terminals.data();
+			write(&index, sizeof(index));
+		}
+
+		source = (net.source == nullptr) ? -1 : net.source->numerical_id;
+		write(&source, sizeof(source));
+	}
+
+	section_size = section.str().size();
+
+	// write image into temporary file first, and then rename it; avoids partially written images; the temporary file is unique for each process, since
+	// several processes may share the same working dir
+	tmp_file = fp.IO_conf.benchmark_image_file + "." + std::to_string(getpid()) + ".tmp";
+	out.open(tmp_file.c_str(), std::ios::binary | std::ios::trunc);
+	if (!out.good()) {
+		return;
 	}
+	out.write(data.data(), data.size());
+	out.write(reinterpret_cast<char const*>(&section_size), sizeof(section_size));
+	out << section.rdbuf();
+	out.close();
 
+	if (!out.good() || std::rename(tmp_file.c_str(), fp.IO_conf.benchmark_image_file.c_str()) != 0) {
+		std::remove(tmp_file.c_str());
+	}
 }
 
 /// output gnuplot maps
@@ -2188,6 +2851,53 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 	int flag, flag_start, flag_stop;
 	double max_temp, min_temp;
 	int id;
+	std::stringstream maps;
+	std::string maps_name;
+	std::string maps_tmp_name;
+	std::ofstream maps_out;
+	std::string data;
+	unsigned long long maps_offset;
+	bool maps_planes;
+	unsigned dim;
+
+	// output values for one bin; text data for gnuplot, or float32 values for binary
+	// maps
+	auto writeBin = [&](unsigned const& x, unsigned const& y, double const& value) {
+		float value_binary;
+
+		if (IO::MAPS_BINARY) {
+			value_binary = static_cast<float>(value);
+			maps.write(reinterpret_cast<char const*>(&value_binary), sizeof(value_binary));
+		}
+		else {
+			data_out << x << "	" << y << "	" << value << "\n";
+		}
+	};
+	// finish a row of bins, for text data only
+	auto writeRowEnd = [&](unsigned const& x) {
+
+		if (IO::MAPS_BINARY) {
+			return;
+		}
+
+		// add dummy data point, required since gnuplot option corners2color cuts last row and column of dataset
+		data_out << x << "	" << dim << "	" << "0.0" << "\n";
+
+		// blank line marks new row for gnuplot
+		data_out << "\n";
+	};
+	// finish all rows of bins, for text data only
+	auto writeDummyRow = [&]() {
+
+		if (IO::MAPS_BINARY) {
+			return;
+		}
+
+		// add dummy data row, required since gnuplot option corners2color cuts last row and column of dataset
+		for (unsigned y = 0; y <= dim; y++) {
+			data_out << dim << "	" << y << "	" << "0.0" << "\n";
+		}
+	};
 
 	// sanity check
 	if (fp.thermalAnalyzer.power_maps.empty() || fp.thermalAnalyzer.thermal_map.empty()) {
@@ -2239,6 +2949,21 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 		flag_start = MAPS_FLAGS::POWER;
 		flag_stop = MAPS_FLAGS::POWER_ORIG;
 	}
+
+	// header for binary maps; padded such that the values are aligned, which
+	// allows to memory-map the container
+	maps_name = fp.benchmark + benchmark_suffix + ".maps";
+	maps_planes = false;
+	maps_offset = 0;
+	if (IO::MAPS_BINARY) {
+		maps.write(IO::MAPS_BINARY_MAGIC.data(), IO::MAPS_BINARY_MAGIC.size());
+		for (unsigned i = IO::MAPS_BINARY_MAGIC.size(); i % sizeof(int) != 0; i++) {
+			maps.put('\0');
+		}
+		maps.write(reinterpret_cast<char const*>(&IO::MAPS_BINARY_VERSION), sizeof(IO::MAPS_BINARY_VERSION));
+		maps.write(reinterpret_cast<char const*>(&fp.IC.layers), sizeof(fp.IC.layers));
+	}
+
 	//
 	// actual map generation	
 	for (flag = flag_start; flag <= flag_stop; flag++) {
@@ -2289,26 +3014,50 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 				data_out_name << fp.benchmark << benchmark_suffix << "_" << cur_layer + 1 << "_routing_util.data";
 			}
 
-			// init file stream for gnuplot script
-			gp_out.open(gp_out_name.str().c_str());
-			// init file stream for data file;
-			// don't open (overwrite) for HotSpot data
-			if (flag != MAPS_FLAGS::THERMAL_HOTSPOT) {
-				data_out.open(data_out_name.str().c_str());
+			// dimensions of maps
+			if (flag == MAPS_FLAGS::POWER) {
+				dim = ThermalAnalyzer::POWER_MAPS_DIM;
 			}
-
-			// file header for data file
-			if (flag == MAPS_FLAGS::POWER || flag == MAPS_FLAGS::POWER_ORIG) {
-				data_out << "# X Y power" << std::endl;
+			else if (flag == MAPS_FLAGS::ROUTING) {
+				dim = RoutingUtilization::UTIL_MAPS_DIM;
 			}
-			else if (flag == MAPS_FLAGS::THERMAL) {
-				data_out << "# X Y thermal" << std::endl;
+			// other dimensions, not padded
+			else {
+				dim = ThermalAnalyzer::THERMAL_MAP_DIM;
 			}
-			else if (flag == MAPS_FLAGS::TSV_DENSITY) {
-				data_out << "# X Y TSV_density" << std::endl;
+
+			// init file stream for gnuplot script
+			gp_out.open((fp.IO_conf.output_dir + gp_out_name.str()).c_str());
+
+			// binary maps; plane header, and memorize offset of values for
+			// gnuplot script; HotSpot data is not handled here
+			if (IO::MAPS_BINARY && flag != MAPS_FLAGS::THERMAL_HOTSPOT) {
+				maps.write(reinterpret_cast<char const*>(&flag), sizeof(flag));
+				maps.write(reinterpret_cast<char const*>(&cur_layer), sizeof(cur_layer));
+				maps.write(reinterpret_cast<char const*>(&dim), sizeof(dim));
+				maps.write(reinterpret_cast<char const*>(&dim), sizeof(dim));
+
+				maps_offset = maps.tellp();
+				maps_planes = true;
 			}
-			else if (flag == MAPS_FLAGS::ROUTING) {
-				data_out << "# X Y routing_util" << std::endl;
+			// init file stream for data file;
+			// don't open (overwrite) for HotSpot data
+			else if (flag != MAPS_FLAGS::THERMAL_HOTSPOT) {
+				data_out.open((fp.IO_conf.output_dir + data_out_name.str()).c_str());
+
+				// file header for data file
+				if (flag == MAPS_FLAGS::POWER || flag == MAPS_FLAGS::POWER_ORIG) {
+					data_out << "# X Y power" << "\n";
+				}
+				else if (flag == MAPS_FLAGS::THERMAL) {
+					data_out << "# X Y thermal" << "\n";
+				}
+				else if (flag == MAPS_FLAGS::TSV_DENSITY) {
+					data_out << "# X Y TSV_density" << "\n";
+				}
+				else if (flag == MAPS_FLAGS::ROUTING) {
+					data_out << "# X Y routing_util" << "\n";
+				}
 			}
 
 			// output grid values for power maps
@@ -2316,20 +3065,13 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 
 				for (x = 0; x < ThermalAnalyzer::POWER_MAPS_DIM; x++) {
 					for (y = 0; y < ThermalAnalyzer::POWER_MAPS_DIM; y++) {
-						data_out << x << "	" << y << "	" << fp.thermalAnalyzer.power_maps[cur_layer][x][y].power_density << std::endl;
+						writeBin(x, y, fp.thermalAnalyzer.power_maps[cur_layer][x][y].power_density);
 					}
 
-					// add dummy data point, required since gnuplot option corners2color cuts last row and column of dataset
-					data_out << x << "	" << ThermalAnalyzer::POWER_MAPS_DIM << "	" << "0.0" << std::endl;
-
-					// blank line marks new row for gnuplot
-					data_out << std::endl;
+					writeRowEnd(x);
 				}
 
-				// add dummy data row, required since gnuplot option corners2color cuts last row and column of dataset
-				for (y = 0; y <= ThermalAnalyzer::POWER_MAPS_DIM; y++) {
-					data_out << ThermalAnalyzer::POWER_MAPS_DIM << "	" << y << "	" << "0.0" << std::endl;
-				}
+				writeDummyRow();
 
 			}
 			// output grid values for original power maps
@@ -2338,20 +3080,13 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 				// not padded, dimensions like thermal map
 				for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
 					for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
-						data_out << x << "	" << y << "	" << fp.thermalAnalyzer.power_maps_orig[cur_layer][x][y].power_density << std::endl;
+						writeBin(x, y, fp.thermalAnalyzer.power_maps_orig[cur_layer][x][y].power_density);
 					}
 
-					// add dummy data point, required since gnuplot option corners2color cuts last row and column of dataset
-					data_out << x << "	" << ThermalAnalyzer::THERMAL_MAP_DIM << "	" << "0.0" << std::endl;
-
-					// blank line marks new row for gnuplot
-					data_out << std::endl;
+					writeRowEnd(x);
 				}
 
-				// add dummy data row, required since gnuplot option corners2color cuts last row and column of dataset
-				for (y = 0; y <= ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
-					data_out << ThermalAnalyzer::THERMAL_MAP_DIM << "	" << y << "	" << "0.0" << std::endl;
-				}
+				writeDummyRow();
 
 			}
 			// output grid values for thermal maps
@@ -2361,23 +3096,16 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 
 				for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
 					for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
-						data_out << x << "	" << y << "	" << fp.thermalAnalyzer.thermal_map[x][y].temp << std::endl;
+						writeBin(x, y, fp.thermalAnalyzer.thermal_map[x][y].temp);
 						// also track max and min temp
 						max_temp = std::max(max_temp, fp.thermalAnalyzer.thermal_map[x][y].temp);
 						min_temp = std::min(min_temp, fp.thermalAnalyzer.thermal_map[x][y].temp);
 					}
 
-					// add dummy data point, required since gnuplot option corners2color cuts last row and column of dataset
-					data_out << x << "	" << ThermalAnalyzer::THERMAL_MAP_DIM << "	" << "0.0" << std::endl;
-
-					// blank line marks new row for gnuplot
-					data_out << std::endl;
+					writeRowEnd(x);
 				}
 
-				// add dummy data row, required since gnuplot option corners2color cuts last row and column of dataset
-				for (y = 0; y <= ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
-					data_out << ThermalAnalyzer::THERMAL_MAP_DIM << "	" << y << "	" << "0.0" << std::endl;
-				}
+				writeDummyRow();
 			}
 			// output grid values for TSV-density maps; consider only bin bins
 			// w/in die outline, not in padded zone
@@ -2387,148 +3115,134 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 					for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
 						// access map bins w/ offset related to
 						// padding zone
-						data_out << x << "	" << y << "	" << fp.thermalAnalyzer.power_maps[cur_layer][x + ThermalAnalyzer::POWER_MAPS_PADDED_BINS][y + ThermalAnalyzer::POWER_MAPS_PADDED_BINS].TSV_density << std::endl;
+						writeBin(x, y, fp.thermalAnalyzer.power_maps[cur_layer][x + ThermalAnalyzer::POWER_MAPS_PADDED_BINS][y + ThermalAnalyzer::POWER_MAPS_PADDED_BINS].TSV_density);
 					}
 
-					// add dummy data point, required since gnuplot option corners2color cuts last row and column of dataset
-					data_out << x << "	" << ThermalAnalyzer::THERMAL_MAP_DIM << "	" << "0.0" << std::endl;
-
-					// blank line marks new row for gnuplot
-					data_out << std::endl;
+					writeRowEnd(x);
 				}
 
-				// add dummy data row, required since gnuplot option corners2color cuts last row and column of dataset
-				for (y = 0; y <= ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
-					data_out << ThermalAnalyzer::THERMAL_MAP_DIM << "	" << y << "	" << "0.0" << std::endl;
-				}
+				writeDummyRow();
 			}
 			// output grid values for routing-utilization maps
 			else if (flag == MAPS_FLAGS::ROUTING) {
 
 				for (x = 0; x < RoutingUtilization::UTIL_MAPS_DIM; x++) {
 					for (y = 0; y < RoutingUtilization::UTIL_MAPS_DIM; y++) {
-						data_out << x << "	" << y << "	" << fp.routingUtil.util_maps[cur_layer][x][y].utilization << std::endl;
+						writeBin(x, y, fp.routingUtil.util_maps[cur_layer][x][y].utilization);
 					}
 
-					// add dummy data point, required since gnuplot option corners2color cuts last row and column of dataset
-					data_out << x << "	" << RoutingUtilization::UTIL_MAPS_DIM << "	" << "0.0" << std::endl;
-
-					// blank line marks new row for gnuplot
-					data_out << std::endl;
+					writeRowEnd(x);
 				}
 
-				// add dummy data row, required since gnuplot option corners2color cuts last row and column of dataset
-				for (y = 0; y <= RoutingUtilization::UTIL_MAPS_DIM; y++) {
-					data_out << RoutingUtilization::UTIL_MAPS_DIM << "	" << y << "	" << "0.0" << std::endl;
-				}
+				writeDummyRow();
 
 			}
 
 			// close file stream for data file
-			if (flag != MAPS_FLAGS::THERMAL_HOTSPOT) {
+			if (!IO::MAPS_BINARY && flag != MAPS_FLAGS::THERMAL_HOTSPOT) {
 				data_out.close();
 			}
 
 			// file header for gnuplot script
 			if (flag == MAPS_FLAGS::POWER) {
-				gp_out << "set title \"Padded and Adapted Power Map - " << fp.benchmark << benchmark_suffix << ", Layer " << cur_layer + 1 << "\" noenhanced" << std::endl;
+				gp_out << "set title \"Padded and Adapted Power Map - " << fp.benchmark << benchmark_suffix << ", Layer " << cur_layer + 1 << "\" noenhanced" << "\n";
 			}
 			else if (flag == MAPS_FLAGS::POWER_ORIG) {
-				gp_out << "set title \"Power Map - " << fp.benchmark << benchmark_suffix << ", Layer " << cur_layer + 1 << "\" noenhanced" << std::endl;
+				gp_out << "set title \"Power Map - " << fp.benchmark << benchmark_suffix << ", Layer " << cur_layer + 1 << "\" noenhanced" << "\n";
 			}
 			else if (flag == MAPS_FLAGS::THERMAL || flag == MAPS_FLAGS::THERMAL_HOTSPOT) {
-				gp_out << "set title \"Thermal Map - " << fp.benchmark << benchmark_suffix << ", Layer " << cur_layer + 1 << "\" noenhanced" << std::endl;
+				gp_out << "set title \"Thermal Map - " << fp.benchmark << benchmark_suffix << ", Layer " << cur_layer + 1 << "\" noenhanced" << "\n";
 			}
 			else if (flag == MAPS_FLAGS::TSV_DENSITY) {
-				gp_out << "set title \"TSV-Density Map - " << fp.benchmark << benchmark_suffix << ", Layer " << cur_layer + 1 << "\" noenhanced" << std::endl;
+				gp_out << "set title \"TSV-Density Map - " << fp.benchmark << benchmark_suffix << ", Layer " << cur_layer + 1 << "\" noenhanced" << "\n";
 			}
 			else if (flag == MAPS_FLAGS::ROUTING) {
-				gp_out << "set title \"Routing-Utilization Map - " << fp.benchmark << benchmark_suffix << ", Layer " << cur_layer + 1 << "\" noenhanced" << std::endl;
+				gp_out << "set title \"Routing-Utilization Map - " << fp.benchmark << benchmark_suffix << ", Layer " << cur_layer + 1 << "\" noenhanced" << "\n";
 			}
 
-			gp_out << "set terminal pdfcairo enhanced font \"Gill Sans, 12\"" << std::endl;
-			gp_out << "set output \"" << gp_out_name.str() << ".pdf\"" << std::endl;
-			gp_out << "set size square" << std::endl;
+			gp_out << "set terminal pdfcairo enhanced font \"Gill Sans, 12\"" << "\n";
+			gp_out << "set output \"" << gp_out_name.str() << ".pdf\"" << "\n";
+			gp_out << "set size square" << "\n";
 
 			// different 2D ranges for maps; consider dummy data row and
 			// column, since gnuplot option corners2color cuts off last row
 			// and column
 			if (flag == MAPS_FLAGS::POWER) {
-				gp_out << "set xrange [0:" << ThermalAnalyzer::POWER_MAPS_DIM << "]" << std::endl;
-				gp_out << "set yrange [0:" << ThermalAnalyzer::POWER_MAPS_DIM << "]" << std::endl;
+				gp_out << "set xrange [0:" << ThermalAnalyzer::POWER_MAPS_DIM << "]" << "\n";
+				gp_out << "set yrange [0:" << ThermalAnalyzer::POWER_MAPS_DIM << "]" << "\n";
 			}
 			// other dimensions, not padded
 			else if (flag == MAPS_FLAGS::POWER_ORIG) {
-				gp_out << "set xrange [0:" << ThermalAnalyzer::THERMAL_MAP_DIM << "]" << std::endl;
-				gp_out << "set yrange [0:" << ThermalAnalyzer::THERMAL_MAP_DIM << "]" << std::endl;
+				gp_out << "set xrange [0:" << ThermalAnalyzer::THERMAL_MAP_DIM << "]" << "\n";
+				gp_out << "set yrange [0:" << ThermalAnalyzer::THERMAL_MAP_DIM << "]" << "\n";
 			}
 			else if (flag == MAPS_FLAGS::THERMAL	|| flag == MAPS_FLAGS::THERMAL_HOTSPOT || flag == MAPS_FLAGS::TSV_DENSITY) {
-				gp_out << "set xrange [0:" << ThermalAnalyzer::THERMAL_MAP_DIM << "]" << std::endl;
-				gp_out << "set yrange [0:" << ThermalAnalyzer::THERMAL_MAP_DIM << "]" << std::endl;
+				gp_out << "set xrange [0:" << ThermalAnalyzer::THERMAL_MAP_DIM << "]" << "\n";
+				gp_out << "set yrange [0:" << ThermalAnalyzer::THERMAL_MAP_DIM << "]" << "\n";
 			}
 			else if (flag == MAPS_FLAGS::ROUTING) {
-				gp_out << "set xrange [0:" << RoutingUtilization::UTIL_MAPS_DIM << "]" << std::endl;
-				gp_out << "set yrange [0:" << RoutingUtilization::UTIL_MAPS_DIM << "]" << std::endl;
+				gp_out << "set xrange [0:" << RoutingUtilization::UTIL_MAPS_DIM << "]" << "\n";
+				gp_out << "set yrange [0:" << RoutingUtilization::UTIL_MAPS_DIM << "]" << "\n";
 			}
 
 			// power maps
 			if (flag == MAPS_FLAGS::POWER || flag == MAPS_FLAGS::POWER_ORIG) {
 				// label for power density
-				gp_out << "set cblabel \"Power Density [10^{-2} {/Symbol m}W/{/Symbol m}m^2]\"" << std::endl;
+				gp_out << "set cblabel \"Power Density [10^{-2} {/Symbol m}W/{/Symbol m}m^2]\"" << "\n";
 			}
 			// thermal maps (power blurring)
 			else if (flag == MAPS_FLAGS::THERMAL) {
 				// fixed scale to avoid remapping to extended range
-				gp_out << "set cbrange [" << min_temp << ":" << max_temp << "]" << std::endl;
+				gp_out << "set cbrange [" << min_temp << ":" << max_temp << "]" << "\n";
 				// thermal estimation, correlates w/ power density
-				gp_out << "set cblabel \"Estimated Temperature [K]\"" << std::endl;
+				gp_out << "set cblabel \"Estimated Temperature [K]\"" << "\n";
 			}
 			// thermal maps (HotSpot)
 			else if (flag == MAPS_FLAGS::THERMAL_HOTSPOT) {
 				// label for HotSpot results
-				gp_out << "set cblabel \"Temperature [K], from HotSpot\"" << std::endl;
+				gp_out << "set cblabel \"Temperature [K], from HotSpot\"" << "\n";
 			}
 			// TSV-density maps
 			else if (flag == MAPS_FLAGS::TSV_DENSITY) {
 				// fixed scale
-				gp_out << "set cbrange [0:100]" << std::endl;
+				gp_out << "set cbrange [0:100]" << "\n";
 				// (TODO) also possible: fixed log scale to emphasize both
 				// low densities (single TSVs) as well as large densities
 				// (TSV cluster, vertical buses)
-				//gp_out << "set log cb" << std::endl;
-				//gp_out << "set cbrange [0.1:100]" << std::endl;
+				//gp_out << "set log cb" << "\n";
+				//gp_out << "set cbrange [0.1:100]" << "\n";
 				// label for power density
-				gp_out << "set cblabel \"TSV-Density [%]\"" << std::endl;
+				gp_out << "set cblabel \"TSV-Density [%]\"" << "\n";
 			}
 			// routing-util maps
 			else if (flag == MAPS_FLAGS::ROUTING) {
 				// label for utilization
-				gp_out << "set cblabel \"Estimated Routing Utilization\"" << std::endl;
+				gp_out << "set cblabel \"Estimated Routing Utilization\"" << "\n";
 			}
 
 			// tics
-			gp_out << "set tics front" << std::endl;
-			gp_out << "set grid xtics ytics ztics" << std::endl;
+			gp_out << "set tics front" << "\n";
+			gp_out << "set grid xtics ytics ztics" << "\n";
 			// pm3d algorithm determines an average value for each pixel,
 			// considering sourrounding pixels;
 			// skip this behaviour w/ ``corners2color''; c1 means to select
 			// the lower-left value, practically loosing one row and column in
 			// the overall plot (compensated for by dummy data; see also
 			// http://gnuplot.sourceforge.net/demo/pm3d.html
-			gp_out << "set pm3d map corners2color c1" << std::endl;
+			gp_out << "set pm3d map corners2color c1" << "\n";
 			//// color printable as gray
-			//gp_out << "set palette rgbformulae 30,31,32" << std::endl;
+			//gp_out << "set palette rgbformulae 30,31,32" << "\n";
 			// mathlab color palette; see
 			// http://www.gnuplotting.org/matlab-colorbar-with-gnuplot/
-			gp_out << "set palette defined ( 0 \"#000090\",\\" << std::endl;
-			gp_out << "1 \"#000fff\",\\" << std::endl;
-			gp_out << "2 \"#0090ff\",\\" << std::endl;
-			gp_out << "3 \"#0fffee\",\\" << std::endl;
-			gp_out << "4 \"#90ff70\",\\" << std::endl;
-			gp_out << "5 \"#ffee00\",\\" << std::endl;
-			gp_out << "6 \"#ff7000\",\\" << std::endl;
-			gp_out << "7 \"#ee0000\",\\" << std::endl;
-			gp_out << "8 \"#7f0000\")" << std::endl;
+			gp_out << "set palette defined ( 0 \"#000090\",\\" << "\n";
+			gp_out << "1 \"#000fff\",\\" << "\n";
+			gp_out << "2 \"#0090ff\",\\" << "\n";
+			gp_out << "3 \"#0fffee\",\\" << "\n";
+			gp_out << "4 \"#90ff70\",\\" << "\n";
+			gp_out << "5 \"#ffee00\",\\" << "\n";
+			gp_out << "6 \"#ff7000\",\\" << "\n";
+			gp_out << "7 \"#ee0000\",\\" << "\n";
+			gp_out << "8 \"#7f0000\")" << "\n";
 
 			// for padded power maps: draw rectangle for unpadded core
 			if (flag == MAPS_FLAGS::POWER && ThermalAnalyzer::POWER_MAPS_PADDED_BINS > 0) {
@@ -2536,7 +3250,7 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 				gp_out << ThermalAnalyzer::POWER_MAPS_PADDED_BINS << ", " << ThermalAnalyzer::POWER_MAPS_PADDED_BINS << " to ";
 				gp_out << ThermalAnalyzer::POWER_MAPS_DIM - ThermalAnalyzer::POWER_MAPS_PADDED_BINS << ", ";
 				gp_out << ThermalAnalyzer::POWER_MAPS_DIM - ThermalAnalyzer::POWER_MAPS_PADDED_BINS << " ";
-				gp_out << "front fillstyle empty border rgb \"white\" linewidth 3" << std::endl;
+				gp_out << "front fillstyle empty border rgb \"white\" linewidth 3" << "\n";
 			}
 
 			// for original power maps
@@ -2565,7 +3279,9 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 						g = Math::randI(0, 256);
 						b = Math::randI(0, 256);
 
-						for (auto& bin : cur_part.second) {
+						for (unsigned i = cur_part.lower_bound; i < cur_part.upper_bound; i++) {
+
+							LeakageAnalyzer::Bin const& bin = fp.leakageAnalyzer.power_bins[cur_layer][i];
 
 							gp_out << "set obj " << id << " rect from ";
 							gp_out << bin.x << ", " << bin.y << " to ";
@@ -2577,9 +3293,9 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 							gp_out << std::hex << std::setfill('0') << std::setw(2) << g;
 							gp_out << std::hex << std::setfill('0') << std::setw(2) << b;
 							gp_out << std::dec;
-							gp_out << "\" linewidth 1" << std::endl;
+							gp_out << "\" linewidth 1" << "\n";
 
-							gp_out << std::endl;
+							gp_out << "\n";
 
 							id++;
 						}
@@ -2606,7 +3322,7 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 					gp_out << " from " << cur_block.bb.ll.x * scaling_factor_x << "," << cur_block.bb.ll.y * scaling_factor_y;
 					gp_out << " to " << cur_block.bb.ur.x * scaling_factor_x << "," << cur_block.bb.ur.y * scaling_factor_y;
 					gp_out << " fillstyle empty border rgb \"white\"";
-					gp_out << std::endl;
+					gp_out << "\n";
 				}
 			}
 
@@ -2626,7 +3342,7 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 							gp_out << x + 1 << ", " << y + 1 << " ";
 							gp_out << "front fillstyle empty border ";
 							gp_out << "rgb \"white\" linewidth 1";
-							gp_out << std::endl;
+							gp_out << "\n";
 
 							id++;
 						}
@@ -2647,7 +3363,7 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 								gp_out << "rgb \"black\" linewidth 1";
 							}
 
-							gp_out << std::endl;
+							gp_out << "\n";
 
 							id++;
 						}
@@ -2675,7 +3391,7 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 					gp_out << " from " << cur_block.bb.ll.x * scaling_factor_x << "," << cur_block.bb.ll.y * scaling_factor_y;
 					gp_out << " to " << cur_block.bb.ur.x * scaling_factor_x << "," << cur_block.bb.ur.y * scaling_factor_y;
 					gp_out << " fillstyle empty border rgb \"white\"";
-					gp_out << std::endl;
+					gp_out << "\n";
 				}
 
 				// output TSVs (blocks)
@@ -2690,7 +3406,7 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 					gp_out << " from " << TSV_group.bb.ll.x * scaling_factor_x << "," << TSV_group.bb.ll.y * scaling_factor_y;
 					gp_out << " to " << TSV_group.bb.ur.x * scaling_factor_x << "," << TSV_group.bb.ur.y * scaling_factor_y;
 					gp_out << " fillstyle solid border rgb \"white\" fillcolor rgb \"white\"";
-					gp_out << std::endl;
+					gp_out << "\n";
 				}
 
 				// output dummy TSVs
@@ -2705,17 +3421,44 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 					gp_out << " from " << TSV_group.bb.ll.x * scaling_factor_x << "," << TSV_group.bb.ll.y * scaling_factor_y;
 					gp_out << " to " << TSV_group.bb.ur.x * scaling_factor_x << "," << TSV_group.bb.ur.y * scaling_factor_y;
 					gp_out << " fillstyle solid border rgb \"white\" fillcolor rgb \"white\"";
-					gp_out << std::endl;
+					gp_out << "\n";
 				}
 			}
 
-			gp_out << "splot \"" << data_out_name.str() << "\" using 1:2:3 notitle" << std::endl;
+			// binary maps; plotted as image, where the origin is shifted such
+			// that the bins are placed as for text data
+			if (IO::MAPS_BINARY && flag != MAPS_FLAGS::THERMAL_HOTSPOT) {
+				gp_out << "splot \"" << maps_name << "\" binary skip=" << maps_offset;
+				gp_out << " array=(" << dim << "," << dim << ") scan=yx format=\"%float32\" endian=default origin=(0.5,0.5,0)";
+				gp_out << " with image notitle" << "\n";
+			}
+			else {
+				gp_out << "splot \"" << data_out_name.str() << "\" using 1:2:3 notitle" << "\n";
+			}
 
 			// close file stream for gnuplot script
 			gp_out.close();
 		}
 	}
 
+	// write binary maps into temporary file first, and then rename it; avoids
+	// partially written containers
+	if (maps_planes) {
+		data = maps.str();
+		maps_tmp_name = fp.IO_conf.output_dir + maps_name + ".tmp";
+
+		maps_out.open(maps_tmp_name.c_str(), std::ios::binary | std::ios::trunc);
+		maps_out.write(data.data(), data.size());
+		maps_out.close();
+
+		if (!maps_out.good() || std::rename(maps_tmp_name.c_str(), (fp.IO_conf.output_dir + maps_name).c_str()) != 0) {
+			std::remove(maps_tmp_name.c_str());
+
+			std::cout << "IO> ";
+			std::cout << "WARNING: binary maps could not be written: " << maps_name << std::endl;
+		}
+	}
+
 	if (fp.logMed()) {
 		std::cout << "IO> ";
 		std::cout << "Done" << std::endl << std::endl;
@@ -2745,30 +3488,30 @@ void IO::writeTempSchedule(FloorPlanner const& fp) {
 	data_out_name << fp.benchmark << "_TempSchedule.data";
 
 	// init file stream for gnuplot script
-	gp_out.open(gp_out_name.str().c_str());
+	gp_out.open((fp.IO_conf.output_dir + gp_out_name.str()).c_str());
 	// init file stream for data file
-	data_out.open(data_out_name.str().c_str());
+	data_out.open((fp.IO_conf.output_dir + data_out_name.str()).c_str());
 
 	// output data: SA step and SA temp
-	data_out << "# Step Temperature (index 0)" << std::endl;
+	data_out << "# Step Temperature (index 0)" << "\n";
 
 	for (FloorPlanner::TempStep step : fp.tempSchedule) {
-		data_out << step.step << " " << step.temp << std::endl;
+		data_out << step.step << " " << step.temp << "\n";
 	}
 
 	// two blank lines trigger gnuplot to interpret data file as separate data sets
-	data_out << std::endl;
-	data_out << std::endl;
+	data_out << "\n";
+	data_out << "\n";
 
 	// output data: SA step and avg costs phase 1
-	data_out << "# Step Avg_Cost_Phase_1 (index 1)" << std::endl;
+	data_out << "# Step Avg_Cost_Phase_1 (index 1)" << "\n";
 
 	// memorize if valid solutions are given at all
 	valid_solutions = false;
 
 	for (FloorPlanner::TempStep step : fp.tempSchedule) {
 
-		data_out << step.step << " " << step.avg_cost << std::endl;
+		data_out << step.step << " " << step.avg_cost << "\n";
 
 		// output data until first valid solution is found
 		if (step.new_best_sol_found) {
@@ -2782,25 +3525,25 @@ void IO::writeTempSchedule(FloorPlanner const& fp) {
 	if (valid_solutions) {
 
 		// two blank lines trigger gnuplot to interpret data file as separate data sets
-		data_out << std::endl;
-		data_out << std::endl;
+		data_out << "\n";
+		data_out << "\n";
 
 		// output data: markers for best-solution steps
-		data_out << "# Step Temperature (only steps w/ new best solutions, index 2)" << std::endl;
+		data_out << "# Step Temperature (only steps w/ new best solutions, index 2)" << "\n";
 
 		for (FloorPlanner::TempStep step : fp.tempSchedule) {
 
 			if (step.new_best_sol_found) {
-				data_out << step.step << " " << step.temp << std::endl;
+				data_out << step.step << " " << step.temp << "\n";
 			}
 		}
 
 		// two blank lines trigger gnuplot to interpret data file as separate data sets
-		data_out << std::endl;
-		data_out << std::endl;
+		data_out << "\n";
+		data_out << "\n";
 
 		// output data: SA step and avg costs phase 2
-		data_out << "# Step Avg_Cost_Phase_2 (index 3)" << std::endl;
+		data_out << "# Step Avg_Cost_Phase_2 (index 3)" << "\n";
 
 		first_valid_sol = false;
 		for (FloorPlanner::TempStep step : fp.tempSchedule) {
@@ -2808,7 +3551,7 @@ void IO::writeTempSchedule(FloorPlanner const& fp) {
 			// output data only after first solution is found and only for
 			// cost larger 0
 			if (first_valid_sol && step.avg_cost > 0.0) {
-				data_out << step.step << " " << step.avg_cost << std::endl;
+				data_out << step.step << " " << step.avg_cost << "\n";
 			}
 
 			if (step.new_best_sol_found) {
@@ -2817,18 +3560,18 @@ void IO::writeTempSchedule(FloorPlanner const& fp) {
 		}
 
 		// two blank lines trigger gnuplot to interpret data file as separate data sets
-		data_out << std::endl;
-		data_out << std::endl;
+		data_out << "\n";
+		data_out << "\n";
 
 		// output data: SA step and best costs phase 2
-		data_out << "# Step Best_Cost_Phase_2 (index 4)" << std::endl;
+		data_out << "# Step Best_Cost_Phase_2 (index 4)" << "\n";
 
 		first_valid_sol = false;
 		for (FloorPlanner::TempStep step : fp.tempSchedule) {
 
 			// output data only after first solution is found
 			if (first_valid_sol) {
-				data_out << step.step << " " << step.cost_best_sol << std::endl;
+				data_out << step.step << " " << step.cost_best_sol << "\n";
 			}
 
 			if (step.new_best_sol_found) {
@@ -2841,66 +3584,66 @@ void IO::writeTempSchedule(FloorPlanner const& fp) {
 	data_out.close();
 
 	// gp header
-	gp_out << "set title \"Temperature and Cost Schedule - " << fp.benchmark << "\" noenhanced" << std::endl;
-	gp_out << "set output \"" << gp_out_name.str() << ".pdf\"" << std::endl;
+	gp_out << "set title \"Temperature and Cost Schedule - " << fp.benchmark << "\" noenhanced" << "\n";
+	gp_out << "set output \"" << gp_out_name.str() << ".pdf\"" << "\n";
 
 	// general settings for more attractive plots, extracted from
 	// http://youinfinitesnake.blogspot.de/2011/02/attractive-scientific-plots-with.html
-	gp_out << "set terminal pdfcairo font \"Gill Sans, 12\" linewidth 4 rounded" << std::endl;
-	gp_out << "# Line style for axes" << std::endl;
-	gp_out << "set style line 80 lt rgb \"#808080\"" << std::endl;
-	gp_out << "# Line style for grid" << std::endl;
-	gp_out << "set style line 81 lt 0  # dashed" << std::endl;
-	gp_out << "set style line 81 lt rgb \"#808080\"  # grey" << std::endl;
-	gp_out << "set grid back linestyle 81" << std::endl;
-	gp_out << "# Remove border on top and right." << std::endl;
-	gp_out << "# Also, put it in grey; no need for so much emphasis on a border." << std::endl;
-	gp_out << "set border 3 back linestyle 80" << std::endl;
-	gp_out << "set xtics nomirror" << std::endl;
-	gp_out << "set ytics nomirror" << std::endl;
-	gp_out << "# Line styles: try to pick pleasing colors, rather" << std::endl;
-	gp_out << "# than strictly primary colors or hard-to-see colors" << std::endl;
-	gp_out << "# like gnuplot's default yellow. Make the lines thick" << std::endl;
-	gp_out << "# so they're easy to see in small plots in papers." << std::endl;
-	gp_out << "set style line 1 lt rgb \"#A00000\" lw 2 pt 1" << std::endl;
-	gp_out << "set style line 2 lt rgb \"#00A000\" lw 2 pt 6" << std::endl;
-	gp_out << "set style line 3 lt rgb \"#5060D0\" lw 2 pt 2" << std::endl;
-	gp_out << "set style line 4 lt rgb \"#F25900\" lw 2 pt 9" << std::endl;
-	gp_out << "set style line 5 lt rgb \"#7806A0\" lw 2 pt 9" << std::endl;
+	gp_out << "set terminal pdfcairo font \"Gill Sans, 12\" linewidth 4 rounded" << "\n";
+	gp_out << "# Line style for axes" << "\n";
+	gp_out << "set style line 80 lt rgb \"#808080\"" << "\n";
+	gp_out << "# Line style for grid" << "\n";
+	gp_out << "set style line 81 lt 0  # dashed" << "\n";
+	gp_out << "set style line 81 lt rgb \"#808080\"  # grey" << "\n";
+	gp_out << "set grid back linestyle 81" << "\n";
+	gp_out << "# Remove border on top and right." << "\n";
+	gp_out << "# Also, put it in grey; no need for so much emphasis on a border." << "\n";
+	gp_out << "set border 3 back linestyle 80" << "\n";
+	gp_out << "set xtics nomirror" << "\n";
+	gp_out << "set ytics nomirror" << "\n";
+	gp_out << "# Line styles: try to pick pleasing colors, rather" << "\n";
+	gp_out << "# than strictly primary colors or hard-to-see colors" << "\n";
+	gp_out << "# like gnuplot's default yellow. Make the lines thick" << "\n";
+	gp_out << "# so they're easy to see in small plots in papers." << "\n";
+	gp_out << "set style line 1 lt rgb \"#A00000\" lw 2 pt 1" << "\n";
+	gp_out << "set style line 2 lt rgb \"#00A000\" lw 2 pt 6" << "\n";
+	gp_out << "set style line 3 lt rgb \"#5060D0\" lw 2 pt 2" << "\n";
+	gp_out << "set style line 4 lt rgb \"#F25900\" lw 2 pt 9" << "\n";
+	gp_out << "set style line 5 lt rgb \"#7806A0\" lw 2 pt 9" << "\n";
 
 	// specific settings: labels
-	gp_out << "set xlabel \"SA Step\"" << std::endl;
-	gp_out << "set ylabel \"SA Temperature\"" << std::endl;
-	gp_out << "set y2label \"Normalized Cost\"" << std::endl;
+	gp_out << "set xlabel \"SA Step\"" << "\n";
+	gp_out << "set ylabel \"SA Temperature\"" << "\n";
+	gp_out << "set y2label \"Normalized Cost\"" << "\n";
 	// specific settings: key, labels box
-	gp_out << "set key box lt rgb \"#808080\" out bottom center" << std::endl;
+	gp_out << "set key box lt rgb \"#808080\" out bottom center" << "\n";
 	// specific settings: log scale (for SA temp)
-	gp_out << "set log y" << std::endl;
-	gp_out << "set format y \"%g\"" << std::endl;
-	gp_out << "set mytics 10" << std::endl;
+	gp_out << "set log y" << "\n";
+	gp_out << "set format y \"%g\"" << "\n";
+	gp_out << "set mytics 10" << "\n";
 	// second, indepentend scale for cost values
-	gp_out << "set y2tics nomirror" << std::endl;
-	gp_out << "set mytics 10" << std::endl;
+	gp_out << "set y2tics nomirror" << "\n";
+	gp_out << "set mytics 10" << "\n";
 	// cut cost above 1 in order to emphasize cost trend
-	gp_out << "set y2range [:1]" << std::endl;
+	gp_out << "set y2range [:1]" << "\n";
 
 	// gp data plot command
-	gp_out << "plot \"" << data_out_name.str() << "\" index 0 using 1:2 title \"SA Temperature\" with lines linestyle 2, \\" << std::endl;
+	gp_out << "plot \"" << data_out_name.str() << "\" index 0 using 1:2 title \"SA Temperature\" with lines linestyle 2, \\" << "\n";
 	// there may be no valid solutions, then only the costs for phase 1 are plotted
 	// besides the temperature schedule
 	if (!valid_solutions) {
 		gp_out << "\"" << data_out_name.str() << "\" index 1";
-		gp_out << " using 1:2 title \"Avg. Cost\" with lines linestyle 3 axes x1y2" << std::endl;
+		gp_out << " using 1:2 title \"Avg. Cost\" with lines linestyle 3 axes x1y2" << "\n";
 	}
 	// otherwise, we consider both cost and the best solutions data sets
 	else {
-		gp_out << "\"" << data_out_name.str() << "\" index 2 using 1:2 title \"Best Solutions\" with points linestyle 1, \\" << std::endl;
+		gp_out << "\"" << data_out_name.str() << "\" index 2 using 1:2 title \"Best Solutions\" with points linestyle 1, \\" << "\n";
 		gp_out << "\"" << data_out_name.str() << "\" index 1";
-		gp_out << " using 1:2 title \"Avg. Cost - SA Phase 1\" with lines linestyle 3 axes x1y2, \\" << std::endl;
+		gp_out << " using 1:2 title \"Avg. Cost - SA Phase 1\" with lines linestyle 3 axes x1y2, \\" << "\n";
 		gp_out << "\"" << data_out_name.str() << "\" index 3";
-		gp_out << " using 1:2 title \"Avg. Cost - SA Phase 2\" with lines linestyle 5 axes x1y2, \\" << std::endl;
+		gp_out << " using 1:2 title \"Avg. Cost - SA Phase 2\" with lines linestyle 5 axes x1y2, \\" << "\n";
 		gp_out << "\"" << data_out_name.str() << "\" index 4";
-		gp_out << " using 1:2 title \"Best Cost - SA Phase 2\" with lines linestyle 4 axes x1y2" << std::endl;
+		gp_out << " using 1:2 title \"Best Cost - SA Phase 2\" with lines linestyle 4 axes x1y2" << "\n";
 	}
 
 	// close file stream
@@ -2953,23 +3696,23 @@ void IO::writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignment
 		out_name << fp.benchmark << benchmark_suffix << "_" << cur_layer + 1 << ".gp";
 
 		// init file stream
-		gp_out.open(out_name.str().c_str());
+		gp_out.open((fp.IO_conf.output_dir + out_name.str()).c_str());
 
 		// file header
-		gp_out << "set title \"Floorplan - " << fp.benchmark << ", Layer " << cur_layer + 1 << "\" noenhanced" << std::endl;
-		gp_out << "set terminal pdfcairo enhanced font \"Gill Sans, 12\"" << std::endl;
-		gp_out << "set output \"" << out_name.str() << ".pdf\"" << std::endl;
-		gp_out << "set size ratio " << ratio_inv << std::endl;
-		gp_out << "set xrange [0:" << fp.IC.outline_x << "]" << std::endl;
-		gp_out << "set yrange [0:" << fp.IC.outline_y << "]" << std::endl;
-		gp_out << "set xlabel \"Width [{/Symbol m}m]\"" << std::endl;
-		gp_out << "set ylabel \"Height [{/Symbol m}m]\"" << std::endl;
-		gp_out << "set xtics " << tics << std::endl;
-		gp_out << "set ytics " << tics << std::endl;
-		gp_out << "set mxtics 4" << std::endl;
-		gp_out << "set mytics 4" << std::endl;
-		gp_out << "set tics front" << std::endl;
-		gp_out << "set grid xtics ytics mxtics mytics" << std::endl;
+		gp_out << "set title \"Floorplan - " << fp.benchmark << ", Layer " << cur_layer + 1 << "\" noenhanced" << "\n";
+		gp_out << "set terminal pdfcairo enhanced font \"Gill Sans, 12\"" << "\n";
+		gp_out << "set output \"" << out_name.str() << ".pdf\"" << "\n";
+		gp_out << "set size ratio " << ratio_inv << "\n";
+		gp_out << "set xrange [0:" << fp.IC.outline_x << "]" << "\n";
+		gp_out << "set yrange [0:" << fp.IC.outline_y << "]" << "\n";
+		gp_out << "set xlabel \"Width [{/Symbol m}m]\"" << "\n";
+		gp_out << "set ylabel \"Height [{/Symbol m}m]\"" << "\n";
+		gp_out << "set xtics " << tics << "\n";
+		gp_out << "set ytics " << tics << "\n";
+		gp_out << "set mxtics 4" << "\n";
+		gp_out << "set mytics 4" << "\n";
+		gp_out << "set tics front" << "\n";
+		gp_out << "set grid xtics ytics mxtics mytics" << "\n";
 
 		// output blocks
 		for (Block const& cur_block : fp.blocks) {
@@ -2989,7 +3732,7 @@ void IO::writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignment
 			else {
 				gp_out << " fillcolor rgb \"#91A1AB\" fillstyle solid";
 			}
-			gp_out << std::endl;
+			gp_out << "\n";
 
 			// label
 			gp_out << "set label \"" << cur_block.id << "\"";
@@ -2997,7 +3740,7 @@ void IO::writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignment
 			gp_out << "," << cur_block.bb.ll.y + 0.01 * fp.IC.outline_y;
 			gp_out << " font \"Gill Sans,4\"";
 			// prevents generating subscripts for underscore in labels
-			gp_out << " noenhanced" << std::endl;
+			gp_out << " noenhanced" << "\n";
 
 			// feasible voltages, as bitset
 			if (MultipleVoltages::DBG_FLOORPLAN) {
@@ -3010,7 +3753,7 @@ void IO::writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignment
 				gp_out << "," << cur_block.bb.ll.y + 0.01 * fp.IC.outline_y;
 				gp_out << " font \"Gill Sans,2\"";
 				// prevents generating subscripts for underscore in labels
-				gp_out << " noenhanced" << std::endl;
+				gp_out << " noenhanced" << "\n";
 			}
 		}
 
@@ -3086,7 +3829,7 @@ void IO::writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignment
 					gp_out << static_cast<int>(0xff - module->min_voltage_index() * (0x99 / (fp.voltageAssignment.parameters.voltages.size() - 1) ));
 				}
 				gp_out << std::dec;
-				gp_out << "00\"" << std::endl;
+				gp_out << "00\"" << "\n";
 
 				// put label once label; to module assigned blocks and their shared voltage
 				if (!label_put) {
@@ -3095,7 +3838,7 @@ void IO::writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignment
 					gp_out << "," << bp::yh(rect) - 0.01 * fp.IC.outline_y;
 					gp_out << " font \"Gill Sans,2\"";
 					// prevents generating subscripts for underscore in labels
-					gp_out << " noenhanced" << std::endl;
+					gp_out << " noenhanced" << "\n";
 
 					label_put = true;
 				}
@@ -3114,7 +3857,7 @@ void IO::writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignment
 			gp_out << " from " << TSV_group.bb.ll.x << "," << TSV_group.bb.ll.y;
 			gp_out << " to " << TSV_group.bb.ur.x << "," << TSV_group.bb.ur.y;
 			gp_out << " fillcolor rgb \"#704a30\" fillstyle solid";
-			gp_out << std::endl;
+			gp_out << "\n";
 
 			// label, only for larger islands not for single TSVs
 			if (TSV_group.TSVs_count > 1) {
@@ -3123,7 +3866,7 @@ void IO::writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignment
 				gp_out << "," << TSV_group.bb.ll.y + 0.01 * fp.IC.outline_y;
 				gp_out << " font \"Gill Sans,2\"";
 				// prevents generating subscripts for underscore in labels
-				gp_out << " noenhanced" << std::endl;
+				gp_out << " noenhanced" << "\n";
 			}
 		}
 
@@ -3139,7 +3882,7 @@ void IO::writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignment
 			gp_out << " from " << TSV_group.bb.ll.x << "," << TSV_group.bb.ll.y;
 			gp_out << " to " << TSV_group.bb.ur.x << "," << TSV_group.bb.ur.y;
 			gp_out << " fillcolor rgb \"#704a30\" fillstyle solid";
-			gp_out << std::endl;
+			gp_out << "\n";
 		}
 
 		// check alignment fulfillment; draw accordingly colored rectangles around
@@ -3366,7 +4109,7 @@ void IO::writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignment
 									gp_out << " fc rgb \"" << alignment_color_failed << "\"";
 								}
 								gp_out << " fs solid";
-								gp_out << std::endl;
+								gp_out << "\n";
 							}
 							// non-zero offset, i.e., offset range;
 							// mark w/ arrows
@@ -3385,7 +4128,7 @@ void IO::writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignment
 									gp_out << " lc rgb \"" << alignment_color_failed << "\"";
 								}
 								gp_out << " lw 3";
-								gp_out << std::endl;
+								gp_out << "\n";
 							}
 						}
 						// range alignments
@@ -3407,7 +4150,7 @@ void IO::writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignment
 								gp_out << " lc rgb \"" << alignment_color_failed << "\"";
 							}
 							gp_out << " lw 3";
-							gp_out << std::endl;
+							gp_out << "\n";
 
 							// upper horizontal line
 							gp_out << "set arrow";
@@ -3425,7 +4168,7 @@ void IO::writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignment
 								gp_out << " lc rgb \"" << alignment_color_failed << "\"";
 							}
 							gp_out << " lw 3";
-							gp_out << std::endl;
+							gp_out << "\n";
 						}
 
 						// fixed offset alignments
@@ -3447,7 +4190,7 @@ void IO::writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignment
 									gp_out << " fc rgb \"" << alignment_color_failed << "\"";
 								}
 								gp_out << " fs solid";
-								gp_out << std::endl;
+								gp_out << "\n";
 							}
 							// non-zero offset, i.e., offset range;
 							// mark w/ arrows
@@ -3466,7 +4209,7 @@ void IO::writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignment
 									gp_out << " lc rgb \"" << alignment_color_failed << "\"";
 								}
 								gp_out << " lw 3";
-								gp_out << std::endl;
+								gp_out << "\n";
 							}
 						}
 						// range alignments
@@ -3488,7 +4231,7 @@ void IO::writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignment
 								gp_out << " lc rgb \"" << alignment_color_failed << "\"";
 							}
 							gp_out << " lw 3";
-							gp_out << std::endl;
+							gp_out << "\n";
 
 							// right vertical line
 							gp_out << "set arrow";
@@ -3506,7 +4249,7 @@ void IO::writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignment
 								gp_out << " lc rgb \"" << alignment_color_failed << "\"";
 							}
 							gp_out << " lw 3";
-							gp_out << std::endl;
+							gp_out << "\n";
 						}
 					}
 				}
@@ -3514,7 +4257,7 @@ void IO::writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignment
 		}
 
 		// file footer
-		gp_out << "plot NaN notitle" << std::endl;
+		gp_out << "plot NaN notitle" << "\n";
 
 		// close file stream
 		gp_out.close();
@@ -3550,14 +4293,14 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 		fp_file << fp.benchmark << benchmark_suffix << "_HotSpot_Si_active_" << cur_layer + 1 << ".flp";
 
 		// init file stream
-		file.open(fp_file.str().c_str());
+		file.open((fp.IO_conf.output_dir + fp_file.str()).c_str());
 
 		// file header
-		file << "# Line Format: <unit-name>\\t<width>\\t<height>\\t<left-x>\\t<bottom-y>\\t<specific-heat>\\t<resistivity>" << std::endl;
-		file << "# all dimensions are in meters" << std::endl;
-		file << "# comment lines begin with a '#'" << std::endl;
-		file << "# comments and empty lines are ignored" << std::endl;
-		file << std::endl;
+		file << "# Line Format: <unit-name>\\t<width>\\t<height>\\t<left-x>\\t<bottom-y>\\t<specific-heat>\\t<resistivity>" << "\n";
+		file << "# all dimensions are in meters" << "\n";
+		file << "# comment lines begin with a '#'" << "\n";
+		file << "# comments and empty lines are ignored" << "\n";
+		file << "\n";
 
 		// output blocks
 		for (Block const& cur_block : fp.blocks) {
@@ -3573,7 +4316,7 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 			file << "	" << cur_block.bb.ll.y * Math::SCALE_UM_M;
 			file << "	" << ThermalAnalyzer::HEAT_CAPACITY_SI;
 			file << "	" << ThermalAnalyzer::THERMAL_RESISTIVITY_SI;
-			file << std::endl;
+			file << "\n";
 		}
 
 		// dummy block to describe layer outline
@@ -3584,7 +4327,7 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 		file << "	0.0";
 		file << "	" << ThermalAnalyzer::HEAT_CAPACITY_SI;
 		file << "	" << ThermalAnalyzer::THERMAL_RESISTIVITY_SI;
-		file << std::endl;
+		file << "\n";
 
 		// close file stream
 		file.close();
@@ -3600,18 +4343,18 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 		bond_fp_file << fp.benchmark << benchmark_suffix << "_HotSpot_bond_" << cur_layer + 1 << ".flp";
 
 		// init file streams
-		file.open(Si_fp_file.str().c_str());
-		file_bond.open(bond_fp_file.str().c_str());
+		file.open((fp.IO_conf.output_dir + Si_fp_file.str()).c_str());
+		file_bond.open((fp.IO_conf.output_dir + bond_fp_file.str()).c_str());
 
 		// file headers
-		file << "# Line Format: <unit-name>\\t<width>\\t<height>\\t<left-x>\\t<bottom-y>\\t<specific-heat>\\t<resistivity>" << std::endl;
-		file << "# all dimensions are in meters" << std::endl;
-		file << "# comment lines begin with a '#'" << std::endl;
-		file << "# comments and empty lines are ignored" << std::endl;
-		file_bond << "# Line Format: <unit-name>\\t<width>\\t<height>\\t<left-x>\\t<bottom-y>\\t<specific-heat>\\t<resistivity>" << std::endl;
-		file_bond << "# all dimensions are in meters" << std::endl;
-		file_bond << "# comment lines begin with a '#'" << std::endl;
-		file_bond << "# comments and empty lines are ignored" << std::endl;
+		file << "# Line Format: <unit-name>\\t<width>\\t<height>\\t<left-x>\\t<bottom-y>\\t<specific-heat>\\t<resistivity>" << "\n";
+		file << "# all dimensions are in meters" << "\n";
+		file << "# comment lines begin with a '#'" << "\n";
+		file << "# comments and empty lines are ignored" << "\n";
+		file_bond << "# Line Format: <unit-name>\\t<width>\\t<height>\\t<left-x>\\t<bottom-y>\\t<specific-heat>\\t<resistivity>" << "\n";
+		file_bond << "# all dimensions are in meters" << "\n";
+		file_bond << "# comment lines begin with a '#'" << "\n";
+		file_bond << "# comments and empty lines are ignored" << "\n";
 
 		// for thermal-analysis fitting runs, we consider one common TSV density
 		// for the whole chip outline
@@ -3624,7 +4367,7 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 			file << "	0.0";
 			file << "	" << ThermalAnalyzer::heatCapSi(fp.techParameters.TSV_group_Cu_area_ratio, fp.power_blurring_parameters.TSV_density);
 			file << "	" << ThermalAnalyzer::thermResSi(fp.techParameters.TSV_group_Cu_area_ratio, fp.power_blurring_parameters.TSV_density);
-			file << std::endl;
+			file << "\n";
 
 			file_bond << "bond_" << cur_layer + 1;
 			file_bond << "	" << fp.IC.outline_x * Math::SCALE_UM_M;
@@ -3633,7 +4376,7 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 			file_bond << "	0.0";
 			file_bond << "	" << ThermalAnalyzer::heatCapBond(fp.techParameters.TSV_group_Cu_area_ratio, fp.power_blurring_parameters.TSV_density);
 			file_bond << "	" << ThermalAnalyzer::thermResBond(fp.techParameters.TSV_group_Cu_area_ratio, fp.power_blurring_parameters.TSV_density);
-			file_bond << std::endl;
+			file_bond << "\n";
 		}
 		// for regular runs, i.e., Corblivar runs, we have to consider different
 		// TSV densities for each grid bin, given in the power_maps
@@ -3702,7 +4445,7 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 					// thermal properties, depending on bin's TSV density
 					file << "	" << ThermalAnalyzer::heatCapSi(fp.techParameters.TSV_group_Cu_area_ratio, fp.thermalAnalyzer.power_maps[cur_layer][x][y].TSV_density);
 					file << "	" << ThermalAnalyzer::thermResSi(fp.techParameters.TSV_group_Cu_area_ratio, fp.thermalAnalyzer.power_maps[cur_layer][x][y].TSV_density);
-					file << std::endl;
+					file << "\n";
 
 					// put grid block as floorplan blocks; bonding layer
 					file_bond << "bond_" << cur_layer + 1 << "_" << map_x << ":" << map_y;
@@ -3715,7 +4458,7 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 					// thermal properties, depending on bin's TSV density
 					file_bond << "	" << ThermalAnalyzer::heatCapBond(fp.techParameters.TSV_group_Cu_area_ratio, fp.thermalAnalyzer.power_maps[cur_layer][x][y].TSV_density);
 					file_bond << "	" << ThermalAnalyzer::thermResBond(fp.techParameters.TSV_group_Cu_area_ratio, fp.thermalAnalyzer.power_maps[cur_layer][x][y].TSV_density);
-					file_bond << std::endl;
+					file_bond << "\n";
 				}
 			}
 		}
@@ -3735,14 +4478,14 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 		BEOL_fp_file << fp.benchmark << benchmark_suffix << "_HotSpot_BEOL_" << cur_layer + 1 << ".flp";
 
 		// init file stream
-		file.open(BEOL_fp_file.str().c_str());
+		file.open((fp.IO_conf.output_dir + BEOL_fp_file.str()).c_str());
 
 		// file header
-		file << "# Line Format: <unit-name>\\t<width>\\t<height>\\t<left-x>\\t<bottom-y>\\t<specific-heat>\\t<resistivity>" << std::endl;
-		file << "# all dimensions are in meters" << std::endl;
-		file << "# comment lines begin with a '#'" << std::endl;
-		file << "# comments and empty lines are ignored" << std::endl;
-		file << std::endl;
+		file << "# Line Format: <unit-name>\\t<width>\\t<height>\\t<left-x>\\t<bottom-y>\\t<specific-heat>\\t<resistivity>" << "\n";
+		file << "# all dimensions are in meters" << "\n";
+		file << "# comment lines begin with a '#'" << "\n";
+		file << "# comments and empty lines are ignored" << "\n";
+		file << "\n";
 
 		// dummy blocks representing bb over all wires; related power consumption
 		// also modeled in ptrace file
@@ -3759,7 +4502,7 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 			file << "	" << cur_wire.bb.ll.y * Math::SCALE_UM_M;
 			file << "	" << ThermalAnalyzer::HEAT_CAPACITY_BEOL;
 			file << "	" << ThermalAnalyzer::THERMAL_RESISTIVITY_BEOL;
-			file << std::endl;
+			file << "\n";
 		}
 
 		// dummy BEOL outline ``block''
@@ -3770,7 +4513,7 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 		file << "	0.0";
 		file << "	" << ThermalAnalyzer::HEAT_CAPACITY_BEOL;
 		file << "	" << ThermalAnalyzer::THERMAL_RESISTIVITY_BEOL;
-		file << std::endl;
+		file << "\n";
 
 		// close file stream
 		file.close();
@@ -3783,7 +4526,7 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 	power_file << fp.benchmark << benchmark_suffix << "_HotSpot.ptrace";
 
 	// init file stream
-	file.open(power_file.str().c_str());
+	file.open((fp.IO_conf.output_dir + power_file.str()).c_str());
 
 	// block sequence in trace file has to follow layer files, thus build up file
 	// according to layer structure
@@ -3818,7 +4561,7 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 		// dummy outline block
 		file << "outline_" << cur_layer + 1 << " ";
 	}
-	file << std::endl;
+	file << "\n";
 
 	// output block power in second line
 	for (cur_layer = 0; cur_layer < fp.IC.layers; cur_layer++) {
@@ -3850,7 +4593,7 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 		// dummy outline block
 		file << "0.0 ";
 	}
-	file << std::endl;
+	file << "\n";
 
 	// close file stream
 	file.close();
@@ -3861,68 +4604,68 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 	stack_file << fp.benchmark << benchmark_suffix << "_HotSpot.lcf";
 
 	// init file stream
-	file.open(stack_file.str().c_str());
+	file.open((fp.IO_conf.output_dir + stack_file.str()).c_str());
 
 	// file header
-	file << "#Lines starting with # are used for commenting" << std::endl;
-	file << "#Blank lines are also ignored" << std::endl;
-	file << std::endl;
-	file << "#File Format:" << std::endl;
-	file << "#<Layer Number>" << std::endl;
-	file << "#<Lateral heat flow Y/N?>" << std::endl;
-	file << "#<Power Dissipation Y/N?>" << std::endl;
-	file << "#<Specific heat capacity in J/(m^3K)>" << std::endl;
-	file << "#<Resistivity in (m-K)/W>" << std::endl;
-	file << "#<Thickness in m>" << std::endl;
-	file << "#<floorplan file>" << std::endl;
-	file << std::endl;
+	file << "#Lines starting with # are used for commenting" << "\n";
+	file << "#Blank lines are also ignored" << "\n";
+	file << "\n";
+	file << "#File Format:" << "\n";
+	file << "#<Layer Number>" << "\n";
+	file << "#<Lateral heat flow Y/N?>" << "\n";
+	file << "#<Power Dissipation Y/N?>" << "\n";
+	file << "#<Specific heat capacity in J/(m^3K)>" << "\n";
+	file << "#<Resistivity in (m-K)/W>" << "\n";
+	file << "#<Thickness in m>" << "\n";
+	file << "#<floorplan file>" << "\n";
+	file << "\n";
 
 	for (cur_layer = 0; cur_layer < fp.IC.layers; cur_layer++) {
 
-		file << "# BEOL (interconnects) layer " << cur_layer + 1 << std::endl;
-		file << 4 * cur_layer << std::endl;
-		file << "Y" << std::endl;
-		file << "Y" << std::endl;
-		file << ThermalAnalyzer::HEAT_CAPACITY_BEOL << std::endl;
-		file << ThermalAnalyzer::THERMAL_RESISTIVITY_BEOL << std::endl;
-		file << fp.techParameters.BEOL_thickness * Math::SCALE_UM_M << std::endl;
-		file << fp.benchmark << benchmark_suffix << "_HotSpot_BEOL_" << cur_layer + 1 << ".flp" << std::endl;
-		file << std::endl;
-
-		file << "# Active Si layer; design layer " << cur_layer + 1 << std::endl;
-		file << 4 * cur_layer + 1 << std::endl;
-		file << "Y" << std::endl;
-		file << "Y" << std::endl;
-		file << ThermalAnalyzer::HEAT_CAPACITY_SI << std::endl;
-		file << ThermalAnalyzer::THERMAL_RESISTIVITY_SI << std::endl;
-		file << fp.techParameters.Si_active_thickness * Math::SCALE_UM_M << std::endl;
-		file << fp.benchmark << benchmark_suffix << "_HotSpot_Si_active_" << cur_layer + 1 << ".flp" << std::endl;
-		file << std::endl;
-
-		file << "# Passive Si layer " << cur_layer + 1 << std::endl;
-		file << 4 * cur_layer + 2 << std::endl;
-		file << "Y" << std::endl;
-		file << "N" << std::endl;
+		file << "# BEOL (interconnects) layer " << cur_layer + 1 << "\n";
+		file << 4 * cur_layer << "\n";
+		file << "Y" << "\n";
+		file << "Y" << "\n";
+		file << ThermalAnalyzer::HEAT_CAPACITY_BEOL << "\n";
+		file << ThermalAnalyzer::THERMAL_RESISTIVITY_BEOL << "\n";
+		file << fp.techParameters.BEOL_thickness * Math::SCALE_UM_M << "\n";
+		file << fp.benchmark << benchmark_suffix << "_HotSpot_BEOL_" << cur_layer + 1 << ".flp" << "\n";
+		file << "\n";
+
+		file << "# Active Si layer; design layer " << cur_layer + 1 << "\n";
+		file << 4 * cur_layer + 1 << "\n";
+		file << "Y" << "\n";
+		file << "Y" << "\n";
+		file << ThermalAnalyzer::HEAT_CAPACITY_SI << "\n";
+		file << ThermalAnalyzer::THERMAL_RESISTIVITY_SI << "\n";
+		file << fp.techParameters.Si_active_thickness * Math::SCALE_UM_M << "\n";
+		file << fp.benchmark << benchmark_suffix << "_HotSpot_Si_active_" << cur_layer + 1 << ".flp" << "\n";
+		file << "\n";
+
+		file << "# Passive Si layer " << cur_layer + 1 << "\n";
+		file << 4 * cur_layer + 2 << "\n";
+		file << "Y" << "\n";
+		file << "N" << "\n";
 		// dummy values, proper values (depending on TSV densities) are in the
 		// actual floorplan file
-		file << ThermalAnalyzer::HEAT_CAPACITY_SI << std::endl;
-		file << ThermalAnalyzer::THERMAL_RESISTIVITY_SI << std::endl;
-		file << fp.techParameters.Si_passive_thickness * Math::SCALE_UM_M << std::endl;
-		file << fp.benchmark << benchmark_suffix << "_HotSpot_Si_passive_" << cur_layer + 1 << ".flp" << std::endl;
-		file << std::endl;
+		file << ThermalAnalyzer::HEAT_CAPACITY_SI << "\n";
+		file << ThermalAnalyzer::THERMAL_RESISTIVITY_SI << "\n";
+		file << fp.techParameters.Si_passive_thickness * Math::SCALE_UM_M << "\n";
+		file << fp.benchmark << benchmark_suffix << "_HotSpot_Si_passive_" << cur_layer + 1 << ".flp" << "\n";
+		file << "\n";
 
 		if (cur_layer < (fp.IC.layers - 1)) {
-			file << "# bond layer " << cur_layer + 1 << "; for F2B bonding to next die " << cur_layer + 2 << std::endl;
-			file << 4 * cur_layer + 3 << std::endl;
-			file << "Y" << std::endl;
-			file << "N" << std::endl;
+			file << "# bond layer " << cur_layer + 1 << "; for F2B bonding to next die " << cur_layer + 2 << "\n";
+			file << 4 * cur_layer + 3 << "\n";
+			file << "Y" << "\n";
+			file << "N" << "\n";
 			// dummy values, proper values (depending on TSV densities) are in
 			// the actual floorplan file
-			file << ThermalAnalyzer::HEAT_CAPACITY_BOND << std::endl;
-			file << ThermalAnalyzer::THERMAL_RESISTIVITY_BOND << std::endl;
-			file << fp.techParameters.bond_thickness * Math::SCALE_UM_M << std::endl;
-			file << fp.benchmark << benchmark_suffix << "_HotSpot_bond_" << cur_layer + 1 << ".flp" << std::endl;
-			file << std::endl;
+			file << ThermalAnalyzer::HEAT_CAPACITY_BOND << "\n";
+			file << ThermalAnalyzer::THERMAL_RESISTIVITY_BOND << "\n";
+			file << fp.techParameters.bond_thickness * Math::SCALE_UM_M << "\n";
+			file << fp.benchmark << benchmark_suffix << "_HotSpot_bond_" << cur_layer + 1 << ".flp" << "\n";
+			file << "\n";
 		}
 	}
 
@@ -3933,3 +4676,399 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 		std::cout << "IO> Done" << std::endl << std::endl;
 	}
 }
+
+/// layout of SA checkpoints: header (magic string, version, hash of benchmark), followed by the state of the SA run; all values are stored in native binary
+/// representation, blocks are referred to by their numerical ids
+void IO::writeCheckpoint(FloorPlanner& fp, CorblivarCore& corb) {
+	std::stringstream checkpoint;
+	std::string data;
+	std::ofstream out;
+	std::string tmp_file;
+	unsigned long long hash;
+	unsigned count, id;
+	unsigned char flag;
+
+	auto write = [&](void const* src, size_t const& size) {
+		checkpoint.write(static_cast<char const*>(src), size);
+	};
+	auto writeRect = [&](Rect const& rect) {
+		write(&rect.ll.x, sizeof(rect.ll.x));
+		write(&rect.ll.y, sizeof(rect.ll.y));
+		write(&rect.ur.x, sizeof(rect.ur.x));
+		write(&rect.ur.y, sizeof(rect.ur.y));
+		write(&rect.w, sizeof(rect.w));
+		write(&rect.h, sizeof(rect.h));
+		write(&rect.area, sizeof(rect.area));
+	};
+	auto writeCBL = [&](CornerBlockList const& CBL) {
+		count = CBL.S.size();
+		write(&count, sizeof(count));
+		for (unsigned t = 0; t < count; t++) {
+			id = CBL.S[t]->numerical_id;
+			write(&id, sizeof(id));
+			write(&CBL.L[t], sizeof(CBL.L[t]));
+			write(&CBL.T[t], sizeof(CBL.T[t]));
+		}
+	};
+
+	// header
+	hash = IO::hashBenchmark(fp);
+	write(IO::CHECKPOINT_MAGIC.data(), IO::CHECKPOINT_MAGIC.size());
+	write(&IO::CHECKPOINT_VERSION, sizeof(IO::CHECKPOINT_VERSION));
+	write(&hash, sizeof(hash));
+
+	// dimensions of data, for sanity checks during readin
+	write(&fp.IC.layers, sizeof(fp.IC.layers));
+	count = fp.blocks.size();
+	write(&count, sizeof(count));
+	count = fp.terminals.size();
+	write(&count, sizeof(count));
+	count = corb.getAlignments().size();
+	write(&count, sizeof(count));
+
+	// state of main SA loop
+	write(&fp.SA_state.iteration, sizeof(fp.SA_state.iteration));
+	write(&fp.SA_state.temp, sizeof(fp.SA_state.temp));
+	write(&fp.SA_state.cooling_phase, sizeof(fp.SA_state.cooling_phase));
+	write(&fp.SA_state.SA_phase_two, sizeof(fp.SA_state.SA_phase_two));
+	write(&fp.SA_state.valid_layout_found, sizeof(fp.SA_state.valid_layout_found));
+	write(&fp.SA_state.iteration_first_valid_layout, sizeof(fp.SA_state.iteration_first_valid_layout));
+	write(&fp.SA_state.fitting_layouts_ratio, sizeof(fp.SA_state.fitting_layouts_ratio));
+	write(&fp.SA_state.best_cost, sizeof(fp.SA_state.best_cost));
+	write(&fp.SA_state.innerLoopMax, sizeof(fp.SA_state.innerLoopMax));
+	write(&fp.SA_state.innerLoopMaxInitial, sizeof(fp.SA_state.innerLoopMaxInitial));
+	write(&fp.SA_state.elapsed_time, sizeof(fp.SA_state.elapsed_time));
+	write(&fp.SA_state.seed, sizeof(fp.SA_state.seed));
+
+	// schedule; the outer-loop limit may be adapted for time budgets
+	write(&fp.schedule.loop_limit, sizeof(fp.schedule.loop_limit));
+
+	// temperature-schedule log
+	count = fp.tempSchedule.size();
+	write(&count, sizeof(count));
+	for (FloorPlanner::TempStep const& step : fp.tempSchedule) {
+		write(&step.step, sizeof(step.step));
+		write(&step.temp, sizeof(step.temp));
+		write(&step.avg_cost, sizeof(step.avg_cost));
+		write(&step.new_best_sol_found, sizeof(step.new_best_sol_found));
+		write(&step.cost_best_sol, sizeof(step.cost_best_sol));
+	}
+
+	// max cost values, for normalization of cost terms
+	write(&fp.max_cost_thermal, sizeof(fp.max_cost_thermal));
+	write(&fp.max_cost_WL, sizeof(fp.max_cost_WL));
+	write(&fp.max_cost_alignments, sizeof(fp.max_cost_alignments));
+	write(&fp.max_cost_routing_util, sizeof(fp.max_cost_routing_util));
+	write(&fp.max_cost_timing, sizeof(fp.max_cost_timing));
+	write(&fp.max_cost_voltage_assignment, sizeof(fp.max_cost_voltage_assignment));
+	write(&fp.max_cost_thermal_leakage, sizeof(fp.max_cost_thermal_leakage));
+	write(&fp.max_cost_TSVs, sizeof(fp.max_cost_TSVs));
+	write(&fp.leakageAnalyzer.max_values.entropy, sizeof(fp.leakageAnalyzer.max_values.entropy));
+	write(&fp.leakageAnalyzer.max_values.correlation, sizeof(fp.leakageAnalyzer.max_values.correlation));
+	write(&fp.voltageAssignment.max_values.inv_power_saving, sizeof(fp.voltageAssignment.max_values.inv_power_saving));
+	write(&fp.voltageAssignment.max_values.corners_avg, sizeof(fp.voltageAssignment.max_values.corners_avg));
+	write(&fp.voltageAssignment.max_values.module_count, sizeof(fp.voltageAssignment.max_values.module_count));
+	write(&fp.voltageAssignment.max_values.level_shifter, sizeof(fp.voltageAssignment.max_values.level_shifter));
+	write(&fp.voltageAssignment.max_values.power_variation_max, sizeof(fp.voltageAssignment.max_values.power_variation_max));
+
+	// delay threshold, adapted dynamically for voltage assignment
+	write(&fp.IC.delay_threshold, sizeof(fp.IC.delay_threshold));
+
+	// die outline and terminal pins, both may be shrunk/scaled during SA
+	write(&fp.IC.outline_x, sizeof(fp.IC.outline_x));
+	write(&fp.IC.outline_y, sizeof(fp.IC.outline_y));
+	for (Pin const& pin : fp.terminals) {
+		write(&pin.bb.ll.x, sizeof(pin.bb.ll.x));
+		write(&pin.bb.ll.y, sizeof(pin.bb.ll.y));
+	}
+
+	// statistics for adaptive op selection
+	write(fp.layoutOp.ops_quality.data(), sizeof(fp.layoutOp.ops_quality));
+	write(fp.layoutOp.ops_reward.data(), sizeof(fp.layoutOp.ops_reward));
+	write(fp.layoutOp.ops_eval_effort.data(), sizeof(fp.layoutOp.ops_eval_effort));
+	write(&fp.layoutOp.ops_avg_improvement, sizeof(fp.layoutOp.ops_avg_improvement));
+
+	// thermal map of previous thermal analysis, required for clustering of signal
+	// TSVs
+	flag = (fp.thermal_analysis.thermal_map != nullptr);
+	write(&flag, sizeof(flag));
+	if (flag) {
+		write(&fp.thermal_analysis.temp_offset, sizeof(fp.thermal_analysis.temp_offset));
+		for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
+			for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+				write(&(*fp.thermal_analysis.thermal_map)[x][y].temp, sizeof(double));
+			}
+		}
+	}
+
+	// status of alignments, as of previous layout evaluation
+	for (CorblivarAlignmentReq const& req : corb.getAlignments()) {
+		flag = req.fulfilled;
+		write(&flag, sizeof(flag));
+	}
+
+	// blocks; current and best shapes/placement, layer, alignment status
+	for (Block const& block : fp.blocks) {
+		writeRect(block.bb);
+		writeRect(block.bb_best);
+		write(&block.layer, sizeof(block.layer));
+		write(&block.alignment, sizeof(block.alignment));
+	}
+
+	// current and best CBLs
+	for (int i = 0; i < fp.IC.layers; i++) {
+		writeCBL(corb.getDie(i).CBL);
+		writeCBL(corb.getDie(i).CBLbest);
+	}
+
+	data = checkpoint.str();
+
+	// write checkpoint into temporary file first, and then rename it; avoids
+	// partially written checkpoints in case the run is interrupted meanwhile
+	tmp_file = fp.IO_conf.checkpoint_file + ".tmp";
+	out.open(tmp_file.c_str(), std::ios::binary | std::ios::trunc);
+	if (out.good()) {
+		out.write(data.data(), data.size());
+		out.close();
+	}
+
+	if (out.good() && std::rename(tmp_file.c_str(), fp.IO_conf.checkpoint_file.c_str()) == 0) {
+
+		if (fp.logMax()) {
+			std::cout << "SA> Checkpoint written: " << fp.IO_conf.checkpoint_file << std::endl;
+		}
+	}
+	else {
+		std::remove(tmp_file.c_str());
+
+		if (fp.logMin()) {
+			std::cout << "SA> Checkpoint could not be written: " << fp.IO_conf.checkpoint_file << std::endl;
+		}
+	}
+}
+
+/// note that the checkpoint has to match the benchmark and the config file; only the former is validated
+void IO::readCheckpoint(FloorPlanner& fp, CorblivarCore& corb) {
+	std::ifstream in;
+	std::stringstream checkpoint;
+	std::string data;
+	size_t pos;
+	unsigned long long hash;
+	int version, layers;
+	unsigned count, id;
+	unsigned char flag;
+	double outline_x, outline_y;
+	bool valid;
+
+	if (fp.logMed()) {
+		std::cout << "IO> Reading checkpoint ..." << std::endl;
+	}
+
+	in.open(fp.IO_conf.checkpoint_file.c_str(), std::ios::binary);
+	if (!in.good()) {
+		std::cout << "IO> No such checkpoint file: " << fp.IO_conf.checkpoint_file << std::endl;
+		exit(1);
+	}
+	checkpoint << in.rdbuf();
+	in.close();
+	data = checkpoint.str();
+
+	pos = 0;
+	auto read = [&](void* dest, size_t const& size) {
+		if (pos + size > data.size()) {
+			return false;
+		}
+		std::copy(data.begin() + pos, data.begin() + pos + size, static_cast<char*>(dest));
+		pos += size;
+		return true;
+	};
+	auto readRect = [&](Rect& rect) {
+		return read(&rect.ll.x, sizeof(rect.ll.x)) &&
+			read(&rect.ll.y, sizeof(rect.ll.y)) &&
+			read(&rect.ur.x, sizeof(rect.ur.x)) &&
+			read(&rect.ur.y, sizeof(rect.ur.y)) &&
+			read(&rect.w, sizeof(rect.w)) &&
+			read(&rect.h, sizeof(rect.h)) &&
+			read(&rect.area, sizeof(rect.area));
+	};
+	auto readCBL = [&](CornerBlockList& CBL) {
+		CornerBlockList::Tuple tuple;
+
+		CBL.clear();
+
+		if (!read(&count, sizeof(count))) {
+			return false;
+		}
+		CBL.reserve(count);
+		for (unsigned t = 0; t < count; t++) {
+			if (!read(&id, sizeof(id)) || id >= fp.blocks.size() ||
+					!read(&tuple.L, sizeof(tuple.L)) ||
+					!read(&tuple.T, sizeof(tuple.T))) {
+				return false;
+			}
+			tuple.S = &fp.blocks[id];
+
+			CBL.insert(std::move(tuple));
+		}
+		return true;
+	};
+	auto parsingError = [&](std::string const& error) {
+		std::cout << "IO> Parsing error in checkpoint file " << fp.IO_conf.checkpoint_file << ": " << error << std::endl;
+		exit(1);
+	};
+
+	// header
+	if (data.compare(0, IO::CHECKPOINT_MAGIC.size(), IO::CHECKPOINT_MAGIC) != 0) {
+		parsingError("no checkpoint");
+	}
+	pos = IO::CHECKPOINT_MAGIC.size();
+	if (!read(&version, sizeof(version)) || version != IO::CHECKPOINT_VERSION) {
+		parsingError("wrong version of checkpoint");
+	}
+	if (!read(&hash, sizeof(hash)) || hash != IO::hashBenchmark(fp)) {
+		parsingError("checkpoint does not match the benchmark " + fp.benchmark);
+	}
+
+	// dimensions of data
+	valid = read(&layers, sizeof(layers)) && layers == fp.IC.layers;
+	valid = valid && read(&count, sizeof(count)) && count == fp.blocks.size();
+	valid = valid && read(&count, sizeof(count)) && count == fp.terminals.size();
+	valid = valid && read(&count, sizeof(count)) && count == corb.getAlignments().size();
+	if (!valid) {
+		parsingError("checkpoint does not match the benchmark " + fp.benchmark + " and/or the config file");
+	}
+
+	// state of main SA loop
+	valid = read(&fp.SA_state.iteration, sizeof(fp.SA_state.iteration)) &&
+		read(&fp.SA_state.temp, sizeof(fp.SA_state.temp)) &&
+		read(&fp.SA_state.cooling_phase, sizeof(fp.SA_state.cooling_phase)) &&
+		read(&fp.SA_state.SA_phase_two, sizeof(fp.SA_state.SA_phase_two)) &&
+		read(&fp.SA_state.valid_layout_found, sizeof(fp.SA_state.valid_layout_found)) &&
+		read(&fp.SA_state.iteration_first_valid_layout, sizeof(fp.SA_state.iteration_first_valid_layout)) &&
+		read(&fp.SA_state.fitting_layouts_ratio, sizeof(fp.SA_state.fitting_layouts_ratio)) &&
+		read(&fp.SA_state.best_cost, sizeof(fp.SA_state.best_cost)) &&
+		read(&fp.SA_state.innerLoopMax, sizeof(fp.SA_state.innerLoopMax)) &&
+		read(&fp.SA_state.innerLoopMaxInitial, sizeof(fp.SA_state.innerLoopMaxInitial)) &&
+		read(&fp.SA_state.elapsed_time, sizeof(fp.SA_state.elapsed_time)) &&
+		read(&fp.SA_state.seed, sizeof(fp.SA_state.seed));
+
+	// schedule
+	valid = valid && read(&fp.schedule.loop_limit, sizeof(fp.schedule.loop_limit));
+
+	// temperature-schedule log
+	valid = valid && read(&count, sizeof(count));
+	fp.tempSchedule.clear();
+	for (unsigned s = 0; valid && s < count; s++) {
+		FloorPlanner::TempStep step;
+
+		valid = read(&step.step, sizeof(step.step)) &&
+			read(&step.temp, sizeof(step.temp)) &&
+			read(&step.avg_cost, sizeof(step.avg_cost)) &&
+			read(&step.new_best_sol_found, sizeof(step.new_best_sol_found)) &&
+			read(&step.cost_best_sol, sizeof(step.cost_best_sol));
+
+		fp.tempSchedule.push_back(std::move(step));
+	}
+
+	// max cost values
+	valid = valid &&
+		read(&fp.max_cost_thermal, sizeof(fp.max_cost_thermal)) &&
+		read(&fp.max_cost_WL, sizeof(fp.max_cost_WL)) &&
+		read(&fp.max_cost_alignments, sizeof(fp.max_cost_alignments)) &&
+		read(&fp.max_cost_routing_util, sizeof(fp.max_cost_routing_util)) &&
+		read(&fp.max_cost_timing, sizeof(fp.max_cost_timing)) &&
+		read(&fp.max_cost_voltage_assignment, sizeof(fp.max_cost_voltage_assignment)) &&
+		read(&fp.max_cost_thermal_leakage, sizeof(fp.max_cost_thermal_leakage)) &&
+		read(&fp.max_cost_TSVs, sizeof(fp.max_cost_TSVs)) &&
+		read(&fp.leakageAnalyzer.max_values.entropy, sizeof(fp.leakageAnalyzer.max_values.entropy)) &&
+		read(&fp.leakageAnalyzer.max_values.correlation, sizeof(fp.leakageAnalyzer.max_values.correlation)) &&
+		read(&fp.voltageAssignment.max_values.inv_power_saving, sizeof(fp.voltageAssignment.max_values.inv_power_saving)) &&
+		read(&fp.voltageAssignment.max_values.corners_avg, sizeof(fp.voltageAssignment.max_values.corners_avg)) &&
+		read(&fp.voltageAssignment.max_values.module_count, sizeof(fp.voltageAssignment.max_values.module_count)) &&
+		read(&fp.voltageAssignment.max_values.level_shifter, sizeof(fp.voltageAssignment.max_values.level_shifter)) &&
+		read(&fp.voltageAssignment.max_values.power_variation_max, sizeof(fp.voltageAssignment.max_values.power_variation_max));
+
+	// delay threshold
+	valid = valid && read(&fp.IC.delay_threshold, sizeof(fp.IC.delay_threshold));
+
+	// die outline and terminal pins
+	valid = valid &&
+		read(&outline_x, sizeof(outline_x)) &&
+		read(&outline_y, sizeof(outline_y));
+	for (Pin& pin : fp.terminals) {
+		valid = valid &&
+			read(&pin.bb.ll.x, sizeof(pin.bb.ll.x)) &&
+			read(&pin.bb.ll.y, sizeof(pin.bb.ll.y));
+
+		// pins are ``point'' blocks w/ zero area
+		pin.bb.ur.x = pin.bb.ll.x;
+		pin.bb.ur.y = pin.bb.ll.y;
+	}
+
+	// statistics for adaptive op selection
+	valid = valid &&
+		read(fp.layoutOp.ops_quality.data(), sizeof(fp.layoutOp.ops_quality)) &&
+		read(fp.layoutOp.ops_reward.data(), sizeof(fp.layoutOp.ops_reward)) &&
+		read(fp.layoutOp.ops_eval_effort.data(), sizeof(fp.layoutOp.ops_eval_effort)) &&
+		read(&fp.layoutOp.ops_avg_improvement, sizeof(fp.layoutOp.ops_avg_improvement));
+
+	// thermal map of previous thermal analysis
+	valid = valid && read(&flag, sizeof(flag));
+	if (valid && flag) {
+		valid = read(&fp.thermal_analysis.temp_offset, sizeof(fp.thermal_analysis.temp_offset));
+
+		for (unsigned x = 0; valid && x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
+			for (unsigned y = 0; valid && y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+				valid = read(&fp.thermalAnalyzer.thermal_map[x][y].temp, sizeof(double));
+			}
+		}
+
+		fp.thermal_analysis.thermal_map = &fp.thermalAnalyzer.thermal_map;
+	}
+
+	// status of alignments
+	for (CorblivarAlignmentReq const& req : corb.getAlignments()) {
+		valid = valid && read(&flag, sizeof(flag));
+		req.fulfilled = flag;
+	}
+
+	// blocks
+	for (Block const& block : fp.blocks) {
+		valid = valid &&
+			readRect(block.bb) &&
+			readRect(block.bb_best) &&
+			read(&block.layer, sizeof(block.layer)) &&
+			read(&block.alignment, sizeof(block.alignment));
+	}
+
+	// current and best CBLs
+	for (int i = 0; i < fp.IC.layers; i++) {
+		valid = valid &&
+			readCBL(corb.editDie(i).CBL) &&
+			readCBL(corb.editDie(i).CBLbest);
+	}
+
+	if (!valid || pos != data.size()) {
+		parsingError("checkpoint is incomplete");
+	}
+
+	// the die outline may have been shrunk; reset related data structures and
+	// properties, as in FloorPlanner::shrinkDieOutlines
+	if (outline_x != fp.IC.outline_x || outline_y != fp.IC.outline_y) {
+
+		fp.IC.outline_x = outline_x;
+		fp.IC.outline_y = outline_y;
+
+		fp.thermalAnalyzer.initPowerMaps(fp.IC.layers, fp.getOutline());
+		fp.routingUtil.initUtilMaps(fp.IC.layers, fp.getOutline());
+
+		fp.IC.die_AR = fp.IC.outline_x / fp.IC.outline_y;
+		fp.IC.die_area = fp.IC.outline_x * fp.IC.outline_y;
+		fp.IC.stack_area = fp.IC.layers * fp.IC.die_area;
+		fp.IC.stack_deadspace = fp.IC.stack_area - fp.IC.blocks_area;
+	}
+
+	if (fp.logMed()) {
+		std::cout << "IO> Done; resume SA run at optimization step " << fp.SA_state.iteration << std::endl << std::endl;
+	}
+}
@@ -47,9 +47,62 @@ class IO {
 
 	// private data, functions
 	private:
-		static constexpr int CONFIG_VERSION = 23;
+		static constexpr int CONFIG_VERSION = 27;
 		static constexpr int TECHNOLOGY_VERSION = 7;
 
+		/// version of benchmark images; to be increased whenever their layout
+		/// changes
+		static constexpr int BENCHMARK_IMAGE_VERSION = 1;
+		/// magic string at begin of benchmark images
+		static const std::string BENCHMARK_IMAGE_MAGIC;
+
+		/// parameters of benchmarks, parsed along w/ blocks and nets, and
+		/// memorized in benchmark images
+		struct BenchmarkParameters {
+			int to_parse_soft_blocks, to_parse_hard_blocks, to_parse_terminals;
+			double GT_fp_width, GT_fp_height;
+			int to_parse_nets;
+			unsigned count_input, count_output, count_degree;
+		};
+
+		/// actual parsing of benchmark files
+		static void parseBlocksFiles(FloorPlanner& fp, BenchmarkParameters& parameters);
+		/// actual parsing of benchmark files
+		static void parseNetsFiles(FloorPlanner& fp, BenchmarkParameters& parameters);
+
+		/// benchmark images: hash over all benchmark files and the parameters
+		/// applied during parsing; required for validation of images
+		static unsigned long long hashBenchmark(FloorPlanner const& fp);
+		/// benchmark images: handlers
+		static bool readBenchmarkImageBlocks(FloorPlanner& fp, BenchmarkParameters& parameters);
+		/// benchmark images: handlers
+		static void writeBenchmarkImageBlocks(FloorPlanner& fp, BenchmarkParameters const& parameters);
+		/// benchmark images: handlers
+		static bool readBenchmarkImageNets(FloorPlanner& fp, BenchmarkParameters& parameters);
+		/// benchmark images: handlers
+		static void writeBenchmarkImageNets(FloorPlanner& fp, BenchmarkParameters const& parameters);
+
+		/// version of SA checkpoints; to be increased whenever their layout
+		/// changes
+		static constexpr int CHECKPOINT_VERSION = 2;
+		/// magic string at begin of SA checkpoints
+		static const std::string CHECKPOINT_MAGIC;
+
+		/// switch for binary maps; instead of separate text data files, all
+		/// power, thermal, TSV-density and routing-utilization maps of a run are
+		/// written into one container of float32 planes, which is referenced by
+		/// the gnuplot scripts
+		///
+		/// layout (native byte order): magic string, padded to 4 bytes; version
+		/// and number of layers (int); then, for each plane, the map flag
+		/// (MAPS_FLAGS) and the layer (int), the dimensions (unsigned), and the
+		/// values, w/ bins in x-major order, i.e., value(x,y) at x * dim_y + y
+		static constexpr bool MAPS_BINARY = false;
+		/// version of binary maps; to be increased whenever their layout changes
+		static constexpr int MAPS_BINARY_VERSION = 1;
+		/// magic string at begin of binary maps
+		static const std::string MAPS_BINARY_MAGIC;
+
 	// constructors, destructors, if any non-implicit
 	private:
 		/// empty default constructor; private in order to avoid instances of ``static'' class
@@ -65,11 +118,19 @@ class IO {
 		static void parseAlignmentRequests(FloorPlanner& fp, std::vector<CorblivarAlignmentReq>& alignments);
 		static void parseNets(FloorPlanner& fp);
 		static void parseCorblivarFile(FloorPlanner& fp, CorblivarCore& corb);
+		/// returns the number of parsed tuples
+		static unsigned parseCorblivarSolution(FloorPlanner& fp, CorblivarCore& corb, std::istream& in);
 		static void writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignmentReq> const& alignment, std::string const& benchmark_suffix = "");
 		static void writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_suffix = "");
 		/// non-const reference due to map acces via []
 		static void writeMaps(FloorPlanner& fp, int const& flag_parameter = -1, std::string const& benchmark_suffix = "");
 		static void writeTempSchedule(FloorPlanner const& fp);
+		/// SA checkpoints; the state of the main SA loop is handled via
+		/// FloorPlanner::SA_state
+		static void writeCheckpoint(FloorPlanner& fp, CorblivarCore& corb);
+		/// SA checkpoints; the state of the main SA loop is handled via
+		/// FloorPlanner::SA_state
+		static void readCheckpoint(FloorPlanner& fp, CorblivarCore& corb);
 };
 
 #endif
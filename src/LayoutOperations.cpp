@@ -104,7 +104,7 @@ bool LayoutOperations::performLayoutOp(CorblivarCore& corb, int const& layout_fi
 				this->prepareHandlingOutlineCriticalBlock(corb, die1, tuple1);
 
 				// perform any random operation on that block
-				this->last_op = op = Math::randI(1, 6);
+				this->last_op = op = this->selectOp();
 			}
 		}
 
@@ -120,9 +120,8 @@ bool LayoutOperations::performLayoutOp(CorblivarCore& corb, int const& layout_fi
 				this->preselectBlockFromLargestNet(corb, die1, tuple1);
 			}
 
-			// see defined op-codes to set random-number ranges; recall that
-			// randI(x,y) is [x,y)
-			this->last_op = op = Math::randI(1, 6);
+			// define random operation, see selectOp()
+			this->last_op = op = this->selectOp();
 		}
 	}
 
@@ -188,6 +187,123 @@ bool LayoutOperations::performLayoutOp(CorblivarCore& corb, int const& layout_fi
 	return ret;
 }
 
+int LayoutOperations::selectOp() const {
+	double sum_quality;
+	double r;
+	int op;
+
+	// see defined op-codes to set random-number ranges; recall that randI(x,y) is
+	// [x,y)
+	if (!LayoutOperations::ADAPTIVE_OP_SELECTION) {
+		return Math::randI(1, LayoutOperations::OPS_REGULAR + 1);
+	}
+
+	sum_quality = 0.0;
+	for (double const& quality : this->ops_quality) {
+		sum_quality += quality;
+	}
+
+	// no op is rewarding currently; select uniformly
+	if (sum_quality <= 0.0) {
+		return Math::randI(1, LayoutOperations::OPS_REGULAR + 1);
+	}
+
+	// probability matching: each op is selected w/ min probability, the remaining
+	// probability mass is distributed according to ops' quality
+	r = Math::randF(0, 1);
+	for (op = 1; op < LayoutOperations::OPS_REGULAR; op++) {
+
+		r -= LayoutOperations::OPS_MIN_PROBABILITY
+			+ (1.0 - LayoutOperations::OPS_REGULAR * LayoutOperations::OPS_MIN_PROBABILITY) * (this->ops_quality[op - 1] / sum_quality);
+
+		if (r < 0.0) {
+			break;
+		}
+	}
+
+	if (LayoutOperations::DBG) {
+		std::cout << "DBG_LAYOUT_OPS> Selected op: " << op << std::endl;
+	}
+
+	return op;
+}
+
+/// an op is rewarded only for accepted layouts which actually improve the cost;
+/// accepted uphill moves are not rewarded since they would favour ops w/ small
+/// perturbations (e.g., switching tuple junctions), which are accepted often but
+/// rarely improve the layout; the reward is the cost improvement itself, normalized by
+/// the avg improvement of all ops, such that ops w/ larger improvements are preferred
+///
+/// the quality of an op is its avg reward per attempt over its avg evaluation effort
+/// per attempt; all attempts are considered for the effort, including rejected and
+/// early-rejected ones, i.e., ops which are often rejected early are cheap to try
+///
+/// note that the effort is given as count of evaluated cost stages (see
+/// FloorPlanner::evaluateLayout), not as measured time; this way, runs remain
+/// reproducible for the same seed
+void LayoutOperations::updateOpStatistics(bool const& accepted, double const& cost_improvement, double const& eval_effort) {
+	double reward;
+	int op;
+
+	// consider only regular ops
+	if (this->last_op < 1 || this->last_op > LayoutOperations::OPS_REGULAR) {
+		return;
+	}
+	op = this->last_op - 1;
+
+	// reward, normalized by recency-weighted avg improvement; the latter is
+	// initialized w/ the first improvement
+	reward = 0.0;
+	if (accepted && cost_improvement > 0.0) {
+
+		if (this->ops_avg_improvement <= 0.0) {
+			this->ops_avg_improvement = cost_improvement;
+		}
+		else {
+			this->ops_avg_improvement += LayoutOperations::OPS_LEARNING_RATE * (cost_improvement - this->ops_avg_improvement);
+		}
+
+		reward = cost_improvement / this->ops_avg_improvement;
+	}
+
+	// recency-weighted reward and evaluation effort per attempt of the op; the
+	// latter is initialized w/ the first attempt
+	this->ops_reward[op] += LayoutOperations::OPS_LEARNING_RATE * (reward - this->ops_reward[op]);
+
+	if (this->ops_eval_effort[op] <= 0.0) {
+		this->ops_eval_effort[op] = eval_effort;
+	}
+	else {
+		this->ops_eval_effort[op] += LayoutOperations::OPS_LEARNING_RATE * (eval_effort - this->ops_eval_effort[op]);
+	}
+
+	// quality: reward per unit of evaluation effort
+	if (this->ops_eval_effort[op] > 0.0) {
+		this->ops_quality[op] = this->ops_reward[op] / this->ops_eval_effort[op];
+	}
+	else {
+		this->ops_quality[op] = this->ops_reward[op];
+	}
+
+	if (LayoutOperations::DBG) {
+		std::cout << "DBG_LAYOUT_OPS> Op statistics:";
+		for (double const& quality : this->ops_quality) {
+			std::cout << " " << quality;
+		}
+		std::cout << std::endl;
+	}
+}
+
+void LayoutOperations::resetOpStatistics() {
+
+	// init all ops as equally rewarding, i.e., uniform selection; the efforts are
+	// initialized w/ the first attempts
+	this->ops_quality.fill(1.0);
+	this->ops_reward.fill(1.0);
+	this->ops_eval_effort.fill(0.0);
+	this->ops_avg_improvement = 0.0;
+}
+
 void LayoutOperations::prepareHandlingOutlineCriticalBlock(CorblivarCore const& corb, int& die1, int& tuple1) const {
 	int random_tuple;
 
@@ -40,9 +40,15 @@ class LayoutOperations {
 
 	// constructors, destructors, if any non-implicit
 	public:
+		/// default constructor
+		LayoutOperations() {
+			this->resetOpStatistics();
+		}
 
 	// public data, functions
 	public:
+		friend class IO;
+
 		/// layout-operation handler
 		bool performLayoutOp(CorblivarCore& corb,
 				int const& layout_fit_counter = 0,
@@ -51,6 +57,14 @@ class LayoutOperations {
 				bool const& cooling_phase_three = false
 			);
 
+		/// adaptive op selection; feedback for the last performed op, i.e.,
+		/// whether the resulting layout was accepted, the cost improvement, and
+		/// the effort for layout evaluation
+		void updateOpStatistics(bool const& accepted, double const& cost_improvement, double const& eval_effort);
+		/// adaptive op selection; resets statistics, e.g., when the cost function
+		/// changes
+		void resetOpStatistics();
+
 		/// layout-operation parameters
 		struct parameters {
 
@@ -113,6 +127,35 @@ class LayoutOperations {
 		/// layout operations op-codes
 		static constexpr int OP_SWAP_ALIGNMENT_COORDINATES = 21;
 
+		/// adaptive op selection; code switch; if not set, the regular ops are
+		/// selected uniformly
+		static constexpr bool ADAPTIVE_OP_SELECTION = true;
+		/// adaptive op selection; count of regular, randomly selected ops, i.e.,
+		/// op-codes 1 to 5
+		static constexpr int OPS_REGULAR = 5;
+		/// adaptive op selection; learning rate for the recency-weighted
+		/// statistics
+		static constexpr double OPS_LEARNING_RATE = 0.05;
+		/// adaptive op selection; min selection probability for each regular op,
+		/// maintains exploration of currently unrewarding ops
+		static constexpr double OPS_MIN_PROBABILITY = 0.05;
+
+		/// adaptive op selection; quality of each regular op, i.e., the reward
+		/// per evaluation effort; ops_quality[0] relates to op-code 1 and so forth
+		std::array<double, OPS_REGULAR> ops_quality;
+		/// adaptive op selection; recency-weighted reward per attempt of each
+		/// regular op, i.e., the normalized cost improvement of accepted layouts
+		std::array<double, OPS_REGULAR> ops_reward;
+		/// adaptive op selection; recency-weighted evaluation effort per attempt
+		/// of each regular op, including rejected attempts
+		std::array<double, OPS_REGULAR> ops_eval_effort;
+		/// adaptive op selection; recency-weighted avg cost improvement of all
+		/// regular ops, for normalization of rewards
+		double ops_avg_improvement;
+		/// adaptive op selection; selects one of the regular ops, via probability
+		/// matching on ops_quality
+		inline int selectOp() const;
+
 		/// layout-operation handler variables
 		mutable int last_op, last_op_die1, last_op_die2, last_op_tuple1, last_op_tuple2, last_op_juncts;
 		/// layout-operation handler
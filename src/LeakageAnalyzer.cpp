@@ -29,10 +29,10 @@
 
 double LeakageAnalyzer::determineSpatialEntropy(int const& layer, std::array< std::array<ThermalAnalyzer::PowerMapBin, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> const& power_map) {
 	double d_int;
-	int cur_d_int;
 	double d_ext;
 	double cur_entropy, entropy;
 	double ratio_bins;
+	long long sum_d_int, sum_d_summed;
 	
 	// for more efficient access into data structures, especially within partitionPowerMap and partitionPowerMapHelper
 	unsigned l = static_cast<unsigned>(layer);
@@ -55,51 +55,50 @@ double LeakageAnalyzer::determineSpatialEntropy(int const& layer, std::array< st
 		// external distance: distance between all elements in this current partition and all elements in all other partitions
 		//
 
-		// calculate step wise for each bin of current partition
+		// Manhattan distances can be summed up separately for x and y dimensions; thus, the internal distances are derived from histograms of the partition's bins
+		// over each dimension, instead of comparing all pairs of bins
 		//
-		d_int = d_ext = 0.0;
-		for (auto const& b1 : cur_part.second) {
+		this->histogram_x.fill(0);
+		this->histogram_y.fill(0);
+		sum_d_summed = 0;
 
-			// for calculation of internal distances, compare each bin to all other bins in partition
-			//
-			cur_d_int = 0;
-			for (auto const& b2 : cur_part.second) {
-
-				// incurs larger overhead than simply adding internal distance of 0 for one bin to itself
-				//// ignore comparison with itself
-				//if (b1.x == b2.x && b1.y == b2.y) {
-				//	continue;
-				//}
-
-				// use look-up table/array for x and y dimensions separately
-				cur_d_int += this->distances[b1.x][b2.x];
-				cur_d_int += this->distances[b1.y][b2.y];
-			}
+		for (unsigned i = cur_part.lower_bound; i < cur_part.upper_bound; i++) {
 
-			// sum up distances over partition
-			//
-			// for calculation of external distances, simply subtract internal distance from pre-calculated sum of distances for this bin to all other bins, to obtain
-			// the distance between this bin and all other bins _not_ in the current partition
-			d_ext += static_cast<double>(this->distances_summed[b1.x][b1.y] - cur_d_int);
-			// sum up internal distances
-			d_int += static_cast<double>(cur_d_int);
+			Bin const& b = this->power_bins[l][i];
+
+			this->histogram_x[b.x]++;
+			this->histogram_y[b.y]++;
+
+			// also sum up the pre-calculated sums of distances for each bin to all other bins
+			sum_d_summed += this->distances_summed[b.x][b.y];
 		}
+
+		// sum of internal distances; over all ordered pairs of bins
+		sum_d_int = LeakageAnalyzer::sumDistances(this->histogram_x) + LeakageAnalyzer::sumDistances(this->histogram_y);
+
+		// for calculation of external distances, simply subtract internal distances from pre-calculated sum of distances for all bins to all other bins, to obtain the
+		// distance between all bins of this partition and all other bins _not_ in the current partition
+		//
+		// note that all these sums are integers, thus the results are exact
+		d_ext = static_cast<double>(sum_d_summed - sum_d_int);
+		d_int = static_cast<double>(sum_d_int);
+
 		// normalize to obtain avg dist; over all compared pairs of elements
-		d_int /= (cur_part.second.size() * (cur_part.second.size() - 1));
+		d_int /= (cur_part.size() * (cur_part.size() - 1));
 		// normalize to obtain avg dist; over all compared pairs of elements
-		d_ext /= (cur_part.second.size() *
+		d_ext /= (cur_part.size() *
 				// size of all other partitions taken together, equals whole grid minus this partition
-				(std::pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2) - cur_part.second.size())
+				(std::pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2) - cur_part.size())
 			);
 
 		// now, calculate the partial entropy for this partition
 		//
-		ratio_bins = cur_part.second.size() / std::pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2);
+		ratio_bins = cur_part.size() / std::pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2);
 		cur_entropy = (d_int / d_ext) * ratio_bins * std::log2(ratio_bins);
 
 		// dbg logging
 		if (DBG) {
-			std::cout << "DBG>  Partition: " << cur_part.first << std::endl;
+			std::cout << "DBG>  Partition: " << cur_part.lower_bound << "," << cur_part.upper_bound << std::endl;
 			std::cout << "DBG>   Avg internal dist: " << d_int << std::endl;
 			std::cout << "DBG>   Avg external dist: " << d_ext << std::endl;
 			std::cout << "DBG>   Partial entropy: " << cur_entropy << std::endl;
@@ -121,72 +120,86 @@ double LeakageAnalyzer::determineSpatialEntropy(int const& layer, std::array< st
 	return entropy;
 }
 
+/// sum of 1D distances over all ordered pairs of bins, where the bins are given as histogram over their coordinates; prefix sums allow for linear runtime
+///
+/// for each coordinate j, the distances to all bins at lower coordinates i sum up to j * count(i < j) - sum(i, for i < j); these are accounted for all bins at j, and
+/// twice since each pair is considered in both orders
+inline long long LeakageAnalyzer::sumDistances(std::array<unsigned, ThermalAnalyzer::THERMAL_MAP_DIM> const& histogram) {
+	long long count_lower, coord_sum_lower;
+	long long ret;
+
+	count_lower = coord_sum_lower = ret = 0;
+
+	for (unsigned j = 0; j < ThermalAnalyzer::THERMAL_MAP_DIM; j++) {
+
+		ret += histogram[j] * (j * count_lower - coord_sum_lower);
+
+		count_lower += histogram[j];
+		coord_sum_lower += static_cast<long long>(j) * histogram[j];
+	}
+
+	return 2 * ret;
+}
+
 void LeakageAnalyzer::partitionPowerMap(unsigned const& layer, std::array< std::array<ThermalAnalyzer::PowerMapBin, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> const& power_map) {
 	double power_avg;
 	double power_std_dev;
-	unsigned m;
-	std::vector<Bin> power_values;
+	double power_min, power_max;
+	unsigned i, m;
 
-	// check if vector for this layer is to be allocated first
-	if (this->power_partitions.size() <= layer) {
+	// check if data structures for this layer are to be allocated first
+	while (this->power_partitions.size() <= layer) {
 
-		// allocate empty vector for current layer
-		this->power_partitions.push_back(
-				// vector of partitions in this layer
-				std::vector< std::pair<std::string, std::vector<Bin>> >()
-			);
-	}
-	// otherwise clear previously used vector
-	else {
-		this->power_partitions[layer].clear();
+		// allocate empty vector of partitions for layer
+		this->power_partitions.emplace_back();
+		// allocate bins for layer
+		this->power_bins.emplace_back();
 	}
+	// clear previously used partitions; capacity is kept
+	this->power_partitions[layer].clear();
 
-	// put power values along with their coordinates into vector; also track avg power
+	std::array<Bin, ThermalAnalyzer::THERMAL_MAP_DIM * ThermalAnalyzer::THERMAL_MAP_DIM>& power_values = this->power_bins[layer];
+
+	// put power values along with their coordinates into bins; also track avg power
 	//
-	power_values.reserve(std::pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2));
+	i = 0;
 	power_avg = 0.0;
 	for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
 		for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
 
-			power_values.push_back({
+			power_values[i] = {
 					x, y,
 					power_map[x][y].power_density
-				});
+				};
+
+			power_avg += power_values[i].value;
 
-			power_avg += power_values.back().value;
+			i++;
 		}
 	}
 	power_avg /= std::pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2);
 
-	// sort vector according to power values
-	std::sort(power_values.begin(), power_values.end(),
-			// lambda expression
-			[](Bin const& b1, Bin const& b2) {
-				// std::sort requires a _strict_ ordering, which is ensured by using lesser-than comparator
-				// http://stackoverflow.com/a/1541909
-				return (b1.value < b2.value);
-			}
-		 );
-
 	if (DBG_VERBOSE) {
 		for (auto const& p : power_values) {
 			std::cout << "DBG>  Power[" << p.x << "][" << p.y << "]: " << p.value << std::endl;
 		}
 	}
 
-	// determine first cut: index of first value larger than avg
-	for (m = 0; m < power_values.size(); m++) {
-		
-		if (power_values[m].value > power_avg) {
-			break;
-		}
-	}
+	// determine first cut: arrange all values not larger than avg before all values larger than avg; m is the index of first value larger than avg
+	//
+	// note that no full sorting is required, the partitioning only depends on the sets of values below and above the avg
+	m = std::partition(power_values.begin(), power_values.end(),
+			// lambda expression
+			[&](Bin const& b) {
+				return (b.value <= power_avg);
+			}
+		) - power_values.begin();
 
 	// start recursive calls; partition these two ranges iteratively further
 	//
 	// note that upper-boundary element is left out for actual calculations, but required as upper boundary for traversal of data structures
-	this->partitionPowerMapHelper(layer, 0, m, power_values);
-	this->partitionPowerMapHelper(layer, m, power_values.size(), power_values);
+	this->partitionPowerMapHelper(layer, 0, m);
+	this->partitionPowerMapHelper(layer, m, power_values.size());
 
 	// now, all partitions along with their power bins are determined and stored in power_partitions
 	//
@@ -197,46 +210,49 @@ void LeakageAnalyzer::partitionPowerMap(unsigned const& layer, std::array< std::
 
 		for (auto const& cur_part : this->power_partitions[layer]) {
 
-			// determine avg power for current partition
+			// determine avg power, min and max power for current partition
 			power_avg = 0.0;
-			for (auto const& bin : cur_part.second) {
-				power_avg += bin.value;
+			power_min = power_max = power_values[cur_part.lower_bound].value;
+			for (i = cur_part.lower_bound; i < cur_part.upper_bound; i++) {
+				power_avg += power_values[i].value;
+				power_min = std::min(power_min, power_values[i].value);
+				power_max = std::max(power_max, power_values[i].value);
 			}
-			power_avg /= cur_part.second.size();
+			power_avg /= cur_part.size();
 
 			// determine sum of squared diffs for std dev
 			power_std_dev = 0.0;
-			for (auto const& bin : cur_part.second) {
-				power_std_dev += std::pow(bin.value - power_avg, 2.0);
+			for (i = cur_part.lower_bound; i < cur_part.upper_bound; i++) {
+				power_std_dev += std::pow(power_values[i].value - power_avg, 2.0);
 			}
 			// determine std dev
-			power_std_dev /= cur_part.second.size();
+			power_std_dev /= cur_part.size();
 			power_std_dev = std::sqrt(power_std_dev);
 			
-			std::cout << "DBG>  Partition: " << cur_part.first << std::endl;
-			std::cout << "DBG>   Size: " << cur_part.second.size() << std::endl;
+			std::cout << "DBG>  Partition: " << cur_part.lower_bound << "," << cur_part.upper_bound << std::endl;
+			std::cout << "DBG>   Size: " << cur_part.size() << std::endl;
 			std::cout << "DBG>   Std dev power: " << power_std_dev << std::endl;
 			std::cout << "DBG>   Avg power: " << power_avg << std::endl;
-			// min value is represented by first bin, since the underlying data of power_values was sorted by power
-			std::cout << "DBG>   Min power: " << cur_part.second.front().value << std::endl;
-			// max value is represented by last bin, since the underlying data of power_values was sorted by power
-			std::cout << "DBG>   Max power: " << cur_part.second.back().value << std::endl;
+			std::cout << "DBG>   Min power: " << power_min << std::endl;
+			std::cout << "DBG>   Max power: " << power_max << std::endl;
 
 			if (DBG_VERBOSE) {
-				for (auto const& bin : cur_part.second) {
-					std::cout << "DBG>   Power[" << bin.x << "][" << bin.y << "]: " << bin.value << std::endl;
+				for (i = cur_part.lower_bound; i < cur_part.upper_bound; i++) {
+					std::cout << "DBG>   Power[" << power_values[i].x << "][" << power_values[i].y << "]: " << power_values[i].value << std::endl;
 				}
 			}
 		}
 	}
 }
 
-/// note that power_partitions are updated in this function
-inline void LeakageAnalyzer::partitionPowerMapHelper(unsigned const& layer, unsigned const& lower_bound, unsigned const& upper_bound, std::vector<Bin> const& power_values) {
+/// note that power_partitions and power_bins are updated in this function
+inline void LeakageAnalyzer::partitionPowerMapHelper(unsigned const& layer, unsigned const& lower_bound, unsigned const& upper_bound) {
 	double avg, std_dev;
 	unsigned range;
 	unsigned m, i;
 
+	std::array<Bin, ThermalAnalyzer::THERMAL_MAP_DIM * ThermalAnalyzer::THERMAL_MAP_DIM>& power_values = this->power_bins[layer];
+
 	// sanity check for proper ranges
 	if (upper_bound <= lower_bound) {
 		return;
@@ -251,7 +267,9 @@ inline void LeakageAnalyzer::partitionPowerMapHelper(unsigned const& layer, unsi
 	}
 	avg /= range;
 
-	// determine sum of squared diffs for std dev
+	// determine sum of squared diffs for std dev; the two-pass evaluation is
+	// retained since the std dev decides on the break criterion below, i.e., a
+	// one-pass evaluation w/ its rounding errors would alter the partitions
 	std_dev = 0.0;
 	for (i = lower_bound; i < upper_bound; i++) {
 		std_dev += std::pow(power_values[i].value - avg, 2.0);
@@ -259,22 +277,19 @@ inline void LeakageAnalyzer::partitionPowerMapHelper(unsigned const& layer, unsi
 	// determine std dev
 	std_dev /= range;
 	std_dev = std::sqrt(std_dev);
-	
 	if (DBG_VERBOSE) {
 		std::cout << "DBG> Current range: " << lower_bound << ", " << upper_bound - 1 << std::endl;
 		std::cout << "DBG>  Std dev: " << std_dev << std::endl;
 		std::cout << "DBG>  Avg: " << avg << std::endl;
-		std::cout << "DBG>  Min: " << power_values[lower_bound].value << std::endl;
-		std::cout << "DBG>  Max: " << power_values[upper_bound - 1].value << std::endl;
 	}
 
-	// determine (potential) cut: index of first value larger than avg
-	for (m = lower_bound; m < upper_bound; m++) {
-		
-		if (power_values[m].value > avg) {
-			break;
-		}
-	}
+	// determine (potential) cut: arrange values not larger than avg before values larger than avg; m is the index of first value larger than avg
+	m = std::partition(power_values.begin() + lower_bound, power_values.begin() + upper_bound,
+			// lambda expression
+			[&](Bin const& b) {
+				return (b.value <= avg);
+			}
+		) - power_values.begin();
 
 	// check break criterion for recursive partitioning;
 	//
@@ -293,15 +308,7 @@ inline void LeakageAnalyzer::partitionPowerMapHelper(unsigned const& layer, unsi
 
 		// if criterion reached, then memorize this current partition as new partition
 		//
-		std::vector<Bin> partition;
-		for (i = lower_bound; i < upper_bound; i++) {
-			partition.push_back(power_values[i]);
-		}
-		this->power_partitions[layer].push_back(
-				std::pair<std::string, std::vector<Bin>>(
-					std::string(std::to_string(lower_bound) + "," + std::to_string(upper_bound)),
-					partition
-				));
+		this->power_partitions[layer].push_back({lower_bound, upper_bound});
 		
 		return;
 	}
@@ -311,73 +318,69 @@ inline void LeakageAnalyzer::partitionPowerMapHelper(unsigned const& layer, unsi
 
 		// recursive call for the two new sub-partitions
 		// note that upper-boundary element is left out for actual calculations, but required as upper boundary for traversal of data structures
-		this->partitionPowerMapHelper(layer, lower_bound, m, power_values);
-		this->partitionPowerMapHelper(layer, m, upper_bound, power_values);
+		this->partitionPowerMapHelper(layer, lower_bound, m);
+		this->partitionPowerMapHelper(layer, m, upper_bound);
 	}
 }
 
+/// the sums are determined in one pass over both maps; the values are shifted by the maps' first bins, which avoids cancellation for the sums of squares
 double LeakageAnalyzer::determinePearsonCorr(std::array< std::array<ThermalAnalyzer::PowerMapBin, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> const& power_map, std::array< std::array<ThermalAnalyzer::ThermalMapBin, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> const* thermal_map) {
-	double avg_power, avg_temp;
-	double max_temp;
-	double std_dev_power, std_dev_temp;
-	double cov;
-	double cur_power_dev, cur_temp_dev;
-	double correlation;
+	ThermalAnalyzer::MapsStats stats;
+	double power, temp;
 
 	// sanity check for thermal map
 	if (thermal_map == nullptr) {
 		return std::nan(nullptr);
 	}
 
-	avg_power = avg_temp = 0.0;
-	max_temp = 0.0;
-	cov = std_dev_power = std_dev_temp = 0.0;
-	correlation = 0.0;
+	stats = {
+		power_map[0][0].power_density,
+		(*thermal_map)[0][0].temp,
+		0.0, 0.0, 0.0, 0.0, 0.0
+	};
 
-	// first pass: determine avg values
-	//
 	for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
 		for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
 
-			avg_power += power_map[x][y].power_density;
-			avg_temp += (*thermal_map)[x][y].temp;
-			max_temp = std::max(max_temp, (*thermal_map)[x][y].temp);
+			power = power_map[x][y].power_density - stats.power_shift;
+			temp = (*thermal_map)[x][y].temp - stats.temp_shift;
+
+			stats.power_sum += power;
+			stats.power_sq_sum += power * power;
+			stats.temp_sum += temp;
+			stats.temp_sq_sum += temp * temp;
+			stats.cross_sum += power * temp;
 		}
 	}
-	avg_power /= std::pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2);
-	avg_temp /= std::pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2);
 
-	// dbg output
-	if (DBG) {
-		std::cout << "DBG> Avg power: " << avg_power << std::endl;
-		std::cout << "DBG> Avg temp: " << avg_temp << std::endl;
-		std::cout << "DBG> Max temp: " << max_temp << std::endl;
-		std::cout << std::endl;
-	}
-	
-	// second pass: determine covariance and standard deviations
-	//
-	for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-		for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+	return LeakageAnalyzer::determinePearsonCorr(stats);
+}
 
-			// deviations of current values from avg values
-			cur_power_dev = power_map[x][y].power_density - avg_power;
-			cur_temp_dev = (*thermal_map)[x][y].temp - avg_temp;
+/// the Pearson correlation is invariant to the shift of values, thus the shifted sums can be used directly
+double LeakageAnalyzer::determinePearsonCorr(ThermalAnalyzer::MapsStats const& stats) {
+	double avg_power, avg_temp;
+	double std_dev_power, std_dev_temp;
+	double cov;
+	double correlation;
+	double bins = std::pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2);
 
-			// covariance
-			cov += cur_power_dev * cur_temp_dev;
+	// avg values, of shifted values
+	avg_power = stats.power_sum / bins;
+	avg_temp = stats.temp_sum / bins;
 
-			// standard deviation, calculate its sqrt later on
-			std_dev_power += std::pow(cur_power_dev, 2.0);
-			std_dev_temp += std::pow(cur_temp_dev, 2.0);
-		}
+	// dbg output
+	if (DBG) {
+		std::cout << "DBG> Avg power: " << avg_power + stats.power_shift << std::endl;
+		std::cout << "DBG> Avg temp: " << avg_temp + stats.temp_shift << std::endl;
+		std::cout << std::endl;
 	}
-	cov /= std::pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2);
-	std_dev_power /= std::pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2);
-	std_dev_temp /= std::pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2);
 
-	std_dev_power = std::sqrt(std_dev_power);
-	std_dev_temp = std::sqrt(std_dev_temp);
+	// covariance and standard deviations; E[XY] - E[X]E[Y] and E[X^2] - E[X]^2, respectively
+	//
+	// rounding errors may result in slightly negative variances for (almost) constant maps; clip them
+	cov = stats.cross_sum / bins - avg_power * avg_temp;
+	std_dev_power = std::sqrt(std::max(0.0, stats.power_sq_sum / bins - avg_power * avg_power));
+	std_dev_temp = std::sqrt(std::max(0.0, stats.temp_sq_sum / bins - avg_temp * avg_temp));
 
 	// calculate Pearson correlation: covariance over product of standard deviations
 	//
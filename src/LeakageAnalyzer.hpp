@@ -69,29 +69,48 @@ class LeakageAnalyzer {
 			double value;
 		};
 
+		/// partition of power bins; the bins are given by the range [lower_bound, upper_bound) of the layer's bins, see power_bins
+		struct Partition {
+			unsigned lower_bound;
+			unsigned upper_bound;
+
+			inline unsigned size() const {
+				return this->upper_bound - this->lower_bound;
+			}
+		};
+
 	// private data, functions
 	private:
-		/// power partitions; outer vector: layers; middle vector: partitions (of layer), inner pair: id and vector of coordinates/indices of bins (of partition), related
-		/// to indices of ThermalAnalyzer::power_maps_orig
-		std::vector< std::vector< std::pair<std::string, std::vector<Bin>> > > power_partitions;
+		/// power bins; outer vector: layers; inner array: all bins of the layer's power map, along with their coordinates related to indices of
+		/// ThermalAnalyzer::power_maps_orig
+		///
+		/// the bins are arranged in place during partitioning, such that each partition covers one contiguous range of bins; the bins are allocated only once and
+		/// reused for each evaluation
+		std::vector< std::array<Bin, ThermalAnalyzer::THERMAL_MAP_DIM * ThermalAnalyzer::THERMAL_MAP_DIM> > power_bins;
+
+		/// power partitions; outer vector: layers; inner vector: partitions (of layer), each referring to a range of power_bins
+		std::vector< std::vector<Partition> > power_partitions;
 
 		/// sum of Manhattan distances from each array bin to all other bins; used for calculation of spatial entropy
 		std::array< std::array<int, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> distances_summed;
 
-		/// Manhattan distances, in 1D, for one bin to another bin; used for calculation of spatial entropy
-		std::array< std::array<int, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> distances;
+		/// histograms of bins over x and y dimensions, for one partition; used for calculation of spatial entropy
+		std::array<unsigned, ThermalAnalyzer::THERMAL_MAP_DIM> histogram_x, histogram_y;
+
+		/// helper to sum up 1D Manhattan distances over all pairs of bins, given as histogram; used for calculation of spatial entropy
+		inline static long long sumDistances(std::array<unsigned, ThermalAnalyzer::THERMAL_MAP_DIM> const& histogram);
 
 		/// nested-means based partitioning of power maps
 		///
-		/// the values of power maps are sorted in a 1D data structure and then ``natural'' breaks are determined by
-		/// recursively bi-partitioning these values, where the mean is the boundary; the partitioning stops once the min/max values are
+		/// the values of power maps are put in a 1D data structure and then ``natural'' breaks are determined by
+		/// recursively bi-partitioning these values in place, where the mean is the boundary; the partitioning stops once the min/max values are
 		void partitionPowerMap(unsigned const& layer,
 				std::array< std::array<ThermalAnalyzer::PowerMapBin, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> const& power_map);
 
 		/// helper for recursive calls for partitioning of power maps
 		///
 		/// note that the upper bound is excluded
-		inline void partitionPowerMapHelper(unsigned const& layer, unsigned const& lower_bound, unsigned const& upper_bound, std::vector<Bin> const& power_values);
+		inline void partitionPowerMapHelper(unsigned const& layer, unsigned const& lower_bound, unsigned const& upper_bound);
 
 		/// helper to init distance arrays, which are used as look-up tables for spatial entropy
 		inline void initDistances() {
@@ -117,22 +136,6 @@ class LeakageAnalyzer {
 					this->distances_summed[x][y] = dist;
 				}
 			}
-
-			// all distances for one bin in 1D array to all other bins in same 1D array
-			//
-			for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-
-				// no need to walk ranges [x][0--x]; they will be covered by symmetric counterparts below;
-				// also, the result of (y - x) is >= 0, so no std::abs call required
-				for (unsigned y = x; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
-
-					// Manhattan distance should suffice for grid coordinates/distances
-					//
-					this->distances[x][y] = y - x;
-					// symmetric counterparts
-					this->distances[y][x] = this->distances[x][y];
-				}
-			}
 		}
 
 	// constructors, destructors, if any non-implicit
@@ -151,6 +154,8 @@ class LeakageAnalyzer {
 				std::array< std::array<ThermalAnalyzer::PowerMapBin, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> const& power_map,
 				std::array< std::array<ThermalAnalyzer::ThermalMapBin, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> const* thermal_map
 			);
+		/// Pearson correlation of power and thermal map, based on sums already determined during thermal analysis
+		static double determinePearsonCorr(ThermalAnalyzer::MapsStats const& stats);
 		
 		/// Spatial entropy of original power map, as proposed by Claramunt
 		double determineSpatialEntropy(int const& layer,
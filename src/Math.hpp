@@ -35,6 +35,32 @@ class Math {
 
 	// private data, functions
 	private:
+		/// state of random-number generator; thread-local, such that
+		/// concurrent runs, see BatchRunner, draw independent and reproducible
+		/// sequences; the generator is the same as for rand() of the GNU C
+		/// library, i.e., for the same seed, the same sequence is drawn
+		struct RandState {
+			random_data data;
+			std::array<char, 128> state;
+
+			RandState() {
+				data = random_data();
+				initstate_r(1, state.data(), state.size(), &data);
+			}
+		};
+
+		/// random-number generator helper
+		inline static RandState& randState() {
+			static thread_local RandState state;
+			return state;
+		};
+
+		/// random-number generator helper
+		inline static int rand() {
+			int32_t r;
+			random_r(&randState().data, &r);
+			return r;
+		};
 
 	// constructors, destructors, if any non-implicit
 	private:
@@ -48,6 +74,17 @@ class Math {
 		/// division by zero
 		static constexpr double epsilon = 1.0e-10;
 
+		/// random-number functions; (re-)initializes the generator of the
+		/// calling thread, like srand()
+		inline static void seedRand(unsigned const& seed) {
+			srandom_r(seed, &randState().data);
+		};
+		/// random-number functions; draws the next seed from the sequence of
+		/// the calling thread, as required for re-initialization of the
+		/// generator, since its state cannot be retrieved
+		inline static unsigned drawSeed() {
+			return Math::rand();
+		};
 		/// random-number functions
 		/// note: range is [min, max)
 		inline static int randI(int const& min, int const& max) {
@@ -55,18 +92,18 @@ class Math {
 				return min;
 			}
 			else {
-				return min + (rand() % (max - min));
+				return min + (Math::rand() % (max - min));
 			}
 		};
 		/// random decision
 		inline static bool randB() {
-			int const r = rand();
+			int const r = Math::rand();
 			return (r < (RAND_MAX / 2));
 		};
 		/// random-number functions
 		/// note: range is [min, max)
 		inline static double randF(double const& min, double const& max) {
-			double const r = static_cast<double>(rand()) / RAND_MAX;
+			double const r = static_cast<double>(Math::rand()) / RAND_MAX;
 			return r * (max - min) + min;
 		};
 
@@ -0,0 +1,538 @@
+/**
+ * =====================================================================================
+ *
+ *    Description:  Corblivar multilevel floorplanning; coarsening of blocks into
+ *    clusters, SA on coarse level, and refinement
+ *
+ *    Copyright (C) 2013-2016 Johann Knechtel, johann aett jknechtel dot de
+ *
+ *    This file is part of Corblivar.
+ *
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// own Corblivar header
+#include "Multilevel.hpp"
+// required Corblivar headers
+#include "FloorPlanner.hpp"
+#include "CorblivarCore.hpp"
+#include "Block.hpp"
+#include "Net.hpp"
+
+/// memory allocation
+constexpr double Multilevel::CLUSTER_AREA_FACTOR;
+/// memory allocation
+constexpr double Multilevel::CLUSTER_DEADSPACE_FACTOR;
+/// memory allocation
+constexpr double Multilevel::REFINE_TEMP_FACTOR;
+/// memory allocation
+constexpr double Multilevel::REFINE_LOOP_RATIO;
+
+bool Multilevel::performSA(FloorPlanner& fp, CorblivarCore& corb) {
+	std::vector< std::vector<unsigned> > members;
+	std::vector<Block> clusters;
+	std::vector<Net> nets;
+	std::vector<Rect> layouts;
+	bool valid_layout_found;
+	double blocks_area, stack_deadspace;
+	bool shrink_die;
+	int coordinator_socket;
+	std::string checkpoint_file;
+
+	// backup all parameters which are modified in the following
+	auto const opt_flags = fp.opt_flags;
+	auto const schedule = fp.schedule;
+	blocks_area = fp.IC.blocks_area;
+	stack_deadspace = fp.IC.stack_deadspace;
+	shrink_die = fp.layoutOp.parameters.shrink_die;
+	coordinator_socket = fp.coordinator_socket;
+	checkpoint_file = fp.IO_conf.checkpoint_file;
+
+	// mark multilevel run; the SA handler is called for each level below
+	fp.multilevel_active = true;
+
+	// checkpoints are not supported for multilevel runs, since the SA state of
+	// the coarse level cannot be restored
+	fp.IO_conf.checkpoint_file.clear();
+
+	/// coarsening
+	//
+	if (fp.logMed()) {
+		std::cout << "Multilevel> Coarsening " << fp.blocks.size() << " blocks and " << fp.nets.size() << " nets ..." << std::endl;
+	}
+
+	Multilevel::clusterBlocks(fp, members);
+	Multilevel::coarsen(fp, members, clusters, nets, layouts);
+
+	if (fp.logMed()) {
+		std::cout << "Multilevel> Done; " << clusters.size() << " clusters and " << nets.size() << " nets" << std::endl;
+		std::cout << std::endl;
+	}
+
+	/// SA on coarse level
+	//
+	// the clusters and nets replace the blocks and nets; note that swapping the
+	// containers retains all pointers to the original blocks
+	std::swap(fp.blocks, clusters);
+	std::swap(fp.nets, nets);
+	fp.voltageAssignment.resetNetsIndex();
+
+	fp.IC.blocks_area = 0.0;
+	for (Block const& cluster : fp.blocks) {
+		fp.IC.blocks_area += cluster.bb.area;
+	}
+	fp.IC.stack_deadspace = fp.IC.stack_area - fp.IC.blocks_area;
+
+	// cost terms related to the original blocks are not considered; alignment
+	// requests, timing graph and voltage assignment refer to the original blocks
+	fp.opt_flags.alignment = false;
+	fp.opt_flags.timing = false;
+	fp.opt_flags.voltage_assignment = false;
+	fp.opt_flags.thermal_leakage = false;
+
+	// the die outline is to be retained for the original blocks
+	fp.layoutOp.parameters.shrink_die = false;
+
+	// solutions of coarse level must not be exchanged w/ other workers
+	fp.coordinator_socket = -1;
+
+	// the remaining time budget is reserved for refinement
+	if (fp.schedule.time_budget > 0.0) {
+		fp.schedule.time_budget = fp.elapsedTime() + (fp.schedule.time_budget - fp.elapsedTime()) * (1.0 - Multilevel::REFINE_LOOP_RATIO);
+	}
+
+	CorblivarCore coarse_corb = CorblivarCore(fp.getLayers(), fp.blocks.size());
+	coarse_corb.initCorblivarRandomly(fp.logMed(), fp.getLayers(), fp.blocks, fp.powerAwareBlockHandling());
+
+	// the refinement has to start from the order of the coarse level, so the
+	// sorting of CBLs for floorplacement is applied only here, not in
+	// FloorPlanner::performSA
+	if (fp.layoutOp.parameters.floorplacement) {
+		coarse_corb.sortCBLs(fp.logMed(), CorblivarCore::SORT_CBLS_BY_BLOCKS_SIZE);
+	}
+
+	if (fp.logMed()) {
+		std::cout << "Multilevel> Performing SA on coarse level ..." << std::endl;
+		std::cout << std::endl;
+	}
+
+	valid_layout_found = fp.performSA(coarse_corb);
+
+	// consider best solution, if any; otherwise the current one
+	if (valid_layout_found) {
+		coarse_corb.applyBestCBLs(fp.logMed());
+	}
+
+	// restore original blocks, nets and parameters
+	std::swap(fp.blocks, clusters);
+	std::swap(fp.nets, nets);
+	fp.voltageAssignment.resetNetsIndex();
+
+	fp.IC.blocks_area = blocks_area;
+	fp.IC.stack_deadspace = stack_deadspace;
+	fp.opt_flags = opt_flags;
+	fp.layoutOp.parameters.shrink_die = shrink_die;
+	fp.coordinator_socket = coordinator_socket;
+
+	/// uncoarsening and refinement
+	//
+	if (fp.logMed()) {
+		std::cout << "Multilevel> Uncoarsening; coarse level " << (valid_layout_found ? "fits" : "does not fit") << " into outline" << std::endl;
+	}
+
+	Multilevel::uncoarsen(fp, coarse_corb, members, layouts, corb);
+
+	// short SA run at low temperatures
+	fp.schedule = schedule;
+	fp.schedule.temp_init_factor *= Multilevel::REFINE_TEMP_FACTOR;
+	fp.schedule.loop_limit = std::max(1.0, std::ceil(fp.schedule.loop_limit * Multilevel::REFINE_LOOP_RATIO));
+
+	if (fp.logMed()) {
+		std::cout << "Multilevel> Performing SA for refinement ..." << std::endl;
+		std::cout << std::endl;
+	}
+
+	valid_layout_found = fp.performSA(corb);
+
+	fp.schedule = schedule;
+	fp.IO_conf.checkpoint_file = checkpoint_file;
+	fp.multilevel_active = false;
+
+	return valid_layout_found;
+}
+
+void Multilevel::clusterBlocks(FloorPlanner const& fp, std::vector< std::vector<unsigned> >& members) {
+	std::vector< std::unordered_map<unsigned, double> > connectivity;
+	std::unordered_map<unsigned, double> candidates;
+	std::vector<bool> clustered;
+	double weight, best_weight;
+	double area, area_limit;
+	unsigned best;
+
+	// connectivity of blocks; clique model, i.e., each pair of blocks of a net is
+	// connected w/ weight 1 / (k - 1) for k blocks of the net
+	connectivity.resize(fp.blocks.size());
+
+	for (Net const& net : fp.nets) {
+
+		if (net.blocks.size() < 2 || net.blocks.size() > Multilevel::NET_SIZE_LIMIT) {
+			continue;
+		}
+
+		weight = 1.0 / (net.blocks.size() - 1);
+
+		for (unsigned i = 0; i < net.blocks.size(); i++) {
+			for (unsigned j = i + 1; j < net.blocks.size(); j++) {
+
+				if (net.blocks[i]->numerical_id == net.blocks[j]->numerical_id) {
+					continue;
+				}
+
+				connectivity[net.blocks[i]->numerical_id][net.blocks[j]->numerical_id] += weight;
+				connectivity[net.blocks[j]->numerical_id][net.blocks[i]->numerical_id] += weight;
+			}
+		}
+	}
+
+	area_limit = Multilevel::CLUSTER_AREA_FACTOR * fp.IC.blocks_area / fp.blocks.size();
+
+	// greedy clustering; each cluster is grown by the block w/ strongest connection
+	// to the cluster, as long as the cluster limits are met; large macros for
+	// floorplacement are not clustered
+	clustered.resize(fp.blocks.size(), false);
+
+	for (unsigned b = 0; b < fp.blocks.size(); b++) {
+
+		if (clustered[b]) {
+			continue;
+		}
+
+		members.push_back({b});
+		clustered[b] = true;
+		area = fp.blocks[b].bb.area;
+
+		if (fp.blocks[b].floorplacement) {
+			continue;
+		}
+
+		candidates = connectivity[b];
+
+		while (members.back().size() < Multilevel::CLUSTER_SIZE) {
+
+			best_weight = 0.0;
+			best = b;
+
+			for (auto const& candidate : candidates) {
+
+				if (clustered[candidate.first] || fp.blocks[candidate.first].floorplacement || area + fp.blocks[candidate.first].bb.area > area_limit) {
+					continue;
+				}
+
+				// ties are resolved by the lower index, for deterministic
+				// clustering
+				if (candidate.second > best_weight || (candidate.second == best_weight && candidate.first < best)) {
+					best_weight = candidate.second;
+					best = candidate.first;
+				}
+			}
+
+			// no more connected block fits into cluster
+			if (best == b) {
+				break;
+			}
+
+			members.back().push_back(best);
+			clustered[best] = true;
+			area += fp.blocks[best].bb.area;
+
+			for (auto const& neighbour : connectivity[best]) {
+				candidates[neighbour.first] += neighbour.second;
+			}
+		}
+
+		// blocks of cluster, largest block first, for packing of clusters
+		std::stable_sort(members.back().begin(), members.back().end(),
+			// lambda expression
+			[&](unsigned const& b1, unsigned const& b2) {
+				return fp.blocks[b1].bb.area > fp.blocks[b2].bb.area;
+			}
+		);
+
+		if (Multilevel::DBG) {
+			std::cout << "DBG_MULTILEVEL> Cluster " << members.size() - 1 << ": " << members.back().size() << " blocks; area: " << area << std::endl;
+		}
+	}
+}
+
+template<typename Cost>
+void Multilevel::placeBlock(CorblivarDie& die, Block const* block, Cost const& cost) {
+	CornerBlockList::Tuple tuple;
+	std::list<Block const*> relev_blocks;
+	std::pair<double, double> cur_cost, best_cost;
+	Direction best_dir;
+	unsigned best_T;
+	bool init;
+
+	tuple.S = block;
+	tuple.L = Direction::HORIZONTAL;
+	tuple.T = 0;
+	block->placed = false;
+
+	die.CBL.insert(CornerBlockList::Tuple(tuple));
+	die.pi = die.CBL.size() - 1;
+
+	best_dir = Direction::HORIZONTAL;
+	best_T = 0;
+	init = false;
+
+	// helper; trial placement for the relevant blocks popped so far
+	auto evaluate = [&](Direction const& dir) {
+
+		if (dir == Direction::HORIZONTAL) {
+			die.determCurrentBlockCoords(Coordinate::Y, relev_blocks);
+			die.determCurrentBlockCoords(Coordinate::X, relev_blocks);
+		}
+		else {
+			die.determCurrentBlockCoords(Coordinate::X, relev_blocks);
+			die.determCurrentBlockCoords(Coordinate::Y, relev_blocks);
+		}
+
+		cur_cost = cost(block->bb);
+
+		if (!init || cur_cost < best_cost) {
+			init = true;
+			best_cost = cur_cost;
+			best_dir = dir;
+			best_T = relev_blocks.empty() ? 0 : relev_blocks.size() - 1;
+		}
+	};
+
+	for (Direction const& dir : {Direction::HORIZONTAL, Direction::VERTICAL}) {
+
+		std::list<Block const*>& stack = (dir == Direction::HORIZONTAL) ? die.Hi : die.Vi;
+		die.CBL.L.back() = dir;
+
+		if (stack.empty()) {
+			evaluate(dir);
+			continue;
+		}
+
+		// the relevant blocks are popped one by one, i.e., all T-junctions
+		// are considered; the stack is restored afterwards
+		while (!stack.empty()) {
+			relev_blocks.splice(relev_blocks.end(), stack, stack.begin());
+			evaluate(dir);
+		}
+
+		stack.splice(stack.begin(), relev_blocks);
+	}
+
+	// actual placement
+	die.CBL.L.back() = best_dir;
+	die.CBL.T.back() = best_T;
+	die.placeCurrentBlock(false);
+}
+
+void Multilevel::coarsen(FloorPlanner const& fp, std::vector< std::vector<unsigned> > const& members, std::vector<Block>& clusters, std::vector<Net>& nets, std::vector<Rect>& layouts) {
+	std::vector<unsigned> cluster_of;
+	CorblivarDie die = CorblivarDie(0);
+	Rect footprint;
+	double area, power, side;
+
+	// clusters as super-blocks; the power is retained, but distributed over the
+	// footprint
+	clusters.reserve(members.size());
+	cluster_of.resize(fp.blocks.size());
+	layouts.resize(fp.blocks.size());
+
+	for (unsigned c = 0; c < members.size(); c++) {
+
+		Block const& first = fp.blocks[members[c][0]];
+
+		// copy first block, in order to retain voltage and timing parameters
+		Block cluster = first;
+		cluster.id = "cluster_" + std::to_string(c);
+		cluster.numerical_id = c;
+
+		area = power = 0.0;
+		for (unsigned const& b : members[c]) {
+			area += fp.blocks[b].bb.area;
+			power += fp.blocks[b].power_density_unscaled * fp.blocks[b].bb.area;
+
+			cluster_of[b] = c;
+		}
+
+		// single blocks are retained as is
+		if (members[c].size() == 1) {
+
+			layouts[first.numerical_id] = first.bb;
+			layouts[first.numerical_id].ll.x = layouts[first.numerical_id].ll.y = 0.0;
+			layouts[first.numerical_id].ur.x = first.bb.w;
+			layouts[first.numerical_id].ur.y = first.bb.h;
+		}
+		// clusters of multiple blocks are hard blocks w/ the footprint of
+		// their packed blocks
+		else {
+			// isolated packing, on an empty die, such that the overflow of a
+			// square footprint is minimal; ties are resolved by the area of
+			// the blocks' bounding box
+			side = std::sqrt(area * Multilevel::CLUSTER_DEADSPACE_FACTOR);
+
+			die.CBL.clear();
+			die.reset();
+
+			for (unsigned const& b : members[c]) {
+
+				Multilevel::placeBlock(die, &fp.blocks[b],
+					// lambda expression
+					[&](Rect const& bb) {
+						Rect const footprint_ = (b == members[c][0]) ? bb : Rect::determBoundingBox(footprint, bb);
+
+						return std::make_pair(std::max(footprint_.w, side) * std::max(footprint_.h, side) - side * side, footprint_.area);
+					}
+				);
+
+				footprint = (b == members[c][0]) ? fp.blocks[b].bb : Rect::determBoundingBox(footprint, fp.blocks[b].bb);
+			}
+
+			// the isolated packing starts in the origin, i.e., the blocks'
+			// coordinates are relative to the cluster's lower-left corner
+			for (unsigned const& b : members[c]) {
+				layouts[b] = fp.blocks[b].bb;
+			}
+
+			cluster.soft = false;
+			cluster.rotatable = true;
+			cluster.floorplacement = false;
+
+			cluster.bb.ll.x = cluster.bb.ll.y = 0.0;
+			cluster.bb.w = cluster.bb.ur.x = footprint.w;
+			cluster.bb.h = cluster.bb.ur.y = footprint.h;
+			cluster.bb.area = footprint.area;
+
+			cluster.power_density_unscaled = cluster.power_density_unscaled_back = power / footprint.area;
+		}
+
+		clusters.push_back(std::move(cluster));
+	}
+
+	// reduced nets; refer to clusters, i.e., the clusters container must not be
+	// modified anymore
+	for (Net const& net : fp.nets) {
+		Net coarse_net = Net(net.id);
+
+		for (Block const* b : net.blocks) {
+			Block const* cluster = &clusters[cluster_of[b->numerical_id]];
+
+			if (std::find(coarse_net.blocks.begin(), coarse_net.blocks.end(), cluster) == coarse_net.blocks.end()) {
+				coarse_net.blocks.push_back(cluster);
+			}
+		}
+
+		// nets w/in clusters are dropped
+		if (coarse_net.blocks.empty() || coarse_net.blocks.size() + net.terminals.size() < 2) {
+			continue;
+		}
+
+		coarse_net.hasExternalPin = net.hasExternalPin;
+		coarse_net.terminals = net.terminals;
+		coarse_net.inputNet = net.inputNet;
+		coarse_net.outputNet = net.outputNet;
+		coarse_net.source = coarse_net.blocks.front();
+
+		nets.push_back(std::move(coarse_net));
+	}
+}
+
+void Multilevel::uncoarsen(FloorPlanner const& fp, CorblivarCore& coarse_corb, std::vector< std::vector<unsigned> > const& members, std::vector<Rect> const& layouts, CorblivarCore& corb) {
+	double x, y;
+	double w;
+	bool rotated;
+
+	// positions of clusters; the coarse layout is replayed w/o packing, since the
+	// fine CBLs are not packed either when the refinement starts
+	coarse_corb.generateLayout(false);
+
+	for (int d = 0; d < fp.getLayers(); d++) {
+
+		CorblivarDie const& coarse_die = coarse_corb.getDie(d);
+		CorblivarDie& die = corb.editDie(d);
+
+		die.CBL.clear();
+		die.reset();
+
+		for (Block const* cluster : coarse_die.CBL.S) {
+
+			std::vector<unsigned> const& cluster_members = members[cluster->numerical_id];
+
+			// the cluster may have been rotated on the coarse level; then, the
+			// layout of its blocks is to be transposed
+			w = 0.0;
+			for (unsigned const& b : cluster_members) {
+				w = std::max(w, layouts[b].ur.x);
+			}
+			rotated = (cluster_members.size() > 1 && cluster->bb.w != w);
+
+			// the blocks are placed, one by one, as close as possible to their
+			// position w/in the cluster
+			for (unsigned const& b : cluster_members) {
+
+				Block const* block = &fp.blocks[b];
+				Rect const& layout = layouts[b];
+
+				// single blocks inherit the shape / orientation from the
+				// coarse level
+				if (cluster_members.size() == 1) {
+					block->bb.w = cluster->bb.w;
+					block->bb.h = cluster->bb.h;
+					x = cluster->bb.ll.x;
+					y = cluster->bb.ll.y;
+				}
+				else if (!rotated) {
+					block->bb.w = layout.w;
+					block->bb.h = layout.h;
+					x = cluster->bb.ll.x + layout.ll.x;
+					y = cluster->bb.ll.y + layout.ll.y;
+				}
+				else {
+					if (block->rotatable) {
+						block->bb.w = layout.h;
+						block->bb.h = layout.w;
+					}
+					else {
+						block->bb.w = layout.w;
+						block->bb.h = layout.h;
+					}
+					x = cluster->bb.ll.x + layout.ll.y;
+					y = cluster->bb.ll.y + layout.ll.x;
+				}
+
+				Multilevel::placeBlock(die, block,
+					// lambda expression
+					[&](Rect const& bb) {
+						return std::make_pair(std::abs(bb.ll.x - x) + std::abs(bb.ll.y - y), 0.0);
+					}
+				);
+
+				// memorize layer in blocks themselves
+				block->layer = d;
+			}
+		}
+	}
+
+	if (fp.logMed()) {
+		std::cout << "Multilevel> Done; expanded " << members.size() << " clusters into " << fp.blocks.size() << " blocks" << std::endl;
+		std::cout << std::endl;
+	}
+}
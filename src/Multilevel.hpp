@@ -0,0 +1,108 @@
+/**
+ * =====================================================================================
+ *
+ *    Description:  Corblivar multilevel floorplanning; coarsening of blocks into
+ *    clusters, SA on coarse level, and refinement
+ *
+ *    Copyright (C) 2013-2016 Johann Knechtel, johann aett jknechtel dot de
+ *
+ *    This file is part of Corblivar.
+ *
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_MULTILEVEL
+#define _CORBLIVAR_MULTILEVEL
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+// forward declarations, if any
+class FloorPlanner;
+class CorblivarCore;
+class CorblivarDie;
+class Block;
+class Rect;
+class Net;
+
+/// Corblivar multilevel floorplanning, for designs w/ very large block counts
+///
+/// strongly connected blocks are clustered into hard super-blocks, w/ the footprint of
+/// their packed blocks, and the nets are reduced accordingly; the SA is performed on
+/// the CBLs of these clusters, w/ alignment, timing, voltage assignment and thermal
+/// leakage not considered; then, the clusters are expanded into their blocks, which
+/// are placed w/in the clusters' footprints, and the resulting CBLs are refined by a
+/// short SA run at low temperatures
+///
+/// for the coarse level, the clusters and reduced nets temporarily replace the blocks
+/// and nets of the FloorPlanner; all other data, e.g., alignment requests and the
+/// timing graph, refer to the original blocks which remain in place
+class Multilevel {
+	private:
+		/// debugging code switch (private)
+		static constexpr bool DBG = false;
+
+	// private constants
+	private:
+		/// coarsening; max count of blocks per cluster
+		static constexpr unsigned CLUSTER_SIZE = 8;
+		/// coarsening; max area of clusters, factor for avg block area
+		static constexpr double CLUSTER_AREA_FACTOR = 8.0;
+		/// coarsening; nets w/ more blocks are not considered for connectivity
+		static constexpr unsigned NET_SIZE_LIMIT = 16;
+		/// coarsening; the blocks of clusters are packed into a square
+		/// footprint w/ their area extended by this factor, accounting for the
+		/// deadspace of packing
+		static constexpr double CLUSTER_DEADSPACE_FACTOR = 1.15;
+
+		/// refinement; factor for the SA start temperature
+		static constexpr double REFINE_TEMP_FACTOR = 0.05;
+		/// refinement; ratio of the outer-loop limit, and of the time budget (if
+		/// any)
+		static constexpr double REFINE_LOOP_RATIO = 0.25;
+
+	// private data, functions
+	private:
+		/// coarsening; clusters the blocks by connectivity, i.e., by weights of a
+		/// clique model for nets; returns the blocks' indices for each cluster
+		static void clusterBlocks(FloorPlanner const& fp, std::vector< std::vector<unsigned> >& members);
+		/// coarsening; generates clusters as super-blocks, w/ the footprint of
+		/// their packed blocks, and the nets reduced accordingly; nets w/in
+		/// clusters are dropped; the layout of blocks w/in their clusters is
+		/// memorized relative to the clusters' lower-left corners
+		static void coarsen(FloorPlanner const& fp, std::vector< std::vector<unsigned> > const& members, std::vector<Block>& clusters, std::vector<Net>& nets, std::vector<Rect>& layouts);
+		/// uncoarsening; expands the clusters, in the order of the coarse CBLs,
+		/// into their blocks; each block is placed as close as possible to its
+		/// position w/in the cluster, as given by the coarse layout (w/o packing)
+		/// and the memorized layout of the cluster
+		static void uncoarsen(FloorPlanner const& fp, CorblivarCore& coarse_corb, std::vector< std::vector<unsigned> > const& members, std::vector<Rect> const& layouts, CorblivarCore& corb);
+		/// coarsening and uncoarsening; appends the tuple of the block to the
+		/// CBL of the die and places the block, w/ direction and T-junctions
+		/// such that the cost, i.e., a pair of values for the block's bounding
+		/// box in lexicographical order, is minimal
+		template<typename Cost>
+		static void placeBlock(CorblivarDie& die, Block const* block, Cost const& cost);
+
+	// constructors, destructors, if any non-implicit
+	private:
+		/// empty default constructor; private in order to avoid instances of ``static'' class
+		Multilevel() {
+		}
+
+	// public data, functions
+	public:
+		/// SA handler; same semantics as FloorPlanner::performSA
+		static bool performSA(FloorPlanner& fp, CorblivarCore& corb);
+};
+
+#endif
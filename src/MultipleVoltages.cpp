@@ -60,7 +60,7 @@ void MultipleVoltages::determineCompoundModules(std::vector<Block> const& blocks
 		module.block_ids[start.numerical_id] = true;
 
 		// init neighbours; pointers to block's neighbour is sufficient
-		for (auto& neighbour : start.contiguous_neighbours) {
+		for (auto& neighbour : cont.contiguousNeighbours(start)) {
 			module.contiguous_neighbours.insert({neighbour.block->numerical_id, &neighbour});
 		}
 
@@ -156,12 +156,10 @@ void MultipleVoltages::determineCompoundModules(std::vector<Block> const& blocks
 
 std::vector<MultipleVoltages::CompoundModule*> const& MultipleVoltages::selectCompoundModules(std::vector<Net> const& all_nets, bool const& finalize, bool const& merge_selected_modules) {
 	MultipleVoltages::CompoundModule* cur_selected_module;
-	MultipleVoltages::CompoundModule* module_to_check;
 	std::vector<MultipleVoltages::CompoundModule*> modules;
 
 	unsigned min_voltage_index;
 
-	bool module_to_remove;
 	bool module_to_merge;
 	unsigned count;
 
@@ -173,6 +171,9 @@ std::vector<MultipleVoltages::CompoundModule*> const& MultipleVoltages::selectCo
 	unsigned max_level_shifter;
 	unsigned min_level_shifter;
 
+	// flags to encode already assigned blocks, similar to CompoundModule::block_ids; used for lazy invalidation of modules comprising any already assigned block
+	std::vector<bool> assigned_blocks;
+
 	// outer vector for layers; inner vector for avg power densities of selected modules in that layer
 	std::vector< std::vector<double> > selected_modules__power_dens_avg;
 
@@ -181,6 +182,12 @@ std::vector<MultipleVoltages::CompoundModule*> const& MultipleVoltages::selectCo
 		selected_modules__power_dens_avg.emplace_back( std::vector<double>() );
 	}
 
+	// init the index of driven nets, only once for each nets container; all modules
+	// share the same size of block_ids
+	if (this->nets_driven.empty() || this->nets_indexed != all_nets.data() || this->nets_indexed_size != all_nets.size()) {
+		this->initNetsIndex(all_nets, this->modules.begin()->second.block_ids.size());
+	}
+
 	// first, determine max/min values, required for cost terms and for ordering
 	//
 	max_power_saving = 0.0;
@@ -193,7 +200,7 @@ std::vector<MultipleVoltages::CompoundModule*> const& MultipleVoltages::selectCo
 
 	// evaluate level shifters only if they shall be considered
 	if (this->parameters.weight_level_shifter > 0) {
-		this->modules.begin()->second.updateLevelShifter(all_nets);
+		this->modules.begin()->second.updateLevelShifter(this->nets_driven);
 		min_level_shifter = this->modules.begin()->second.level_shifter();
 	}
 
@@ -210,7 +217,7 @@ std::vector<MultipleVoltages::CompoundModule*> const& MultipleVoltages::selectCo
 
 		// evaluate level shifters only if they shall be considered
 		if (this->parameters.weight_level_shifter > 0) {
-			it->second.updateLevelShifter(all_nets);
+			it->second.updateLevelShifter(this->nets_driven);
 			max_level_shifter = std::max(max_level_shifter, it->second.level_shifter());
 			min_level_shifter = std::min(min_level_shifter, it->second.level_shifter());
 		}
@@ -220,9 +227,9 @@ std::vector<MultipleVoltages::CompoundModule*> const& MultipleVoltages::selectCo
 		}
 	}
 
-	
-	// second, insert all modules' pointers into new vector, to be sorted next
+	// second, insert all modules' pointers into new vector, to be ordered next
 	//
+	modules.reserve(this->modules.size());
 	for (auto it = this->modules.begin(); it != this->modules.end(); ++it) {
 		modules.push_back(&(it->second));
 
@@ -230,95 +237,155 @@ std::vector<MultipleVoltages::CompoundModule*> const& MultipleVoltages::selectCo
 		it->second.setCost(max_power_saving, min_power_saving, max_power_std_dev, max_count, max_corners, max_level_shifter, min_level_shifter, this->parameters);
 	}
 
-	// initial sort; solely based on above set cost, i.e., without consideration of inter-volume variations (via selected_modules__power_dens_avg), but still with consideration
-	// of std dev of power densities within volumes
-	std::sort(modules.begin(), modules.end(),
-			// lambda expression
-			[](CompoundModule const* m1, CompoundModule const* m2) {
+	// ordering criterion; returns true if module m1 w/ cost c1 is better than module m2 w/ cost c2
+	//
+	auto better = [](double const& c1, CompoundModule const* m1, double const& c2, CompoundModule const* m2) {
 
-				// std::sort requires a _strict_ ordering, thus we have to make sure that same elements returns false
-				// http://stackoverflow.com/a/1541909
-				// also helps to make comparison short-cutting it early
-				//
-				return (m1 != m2) && (
-						// the smaller the cost the better; sort in ascending order
-						(m1->cost < m2->cost) ||
-						// in case cost are the same, which typically happens for modules being trivial (in some way to the current cost parameters),
-						// also consider the number of covered blocks, in order to prefer more larger volumes instead of trivial modules
-						((m1->cost == m2->cost) && (m1->blocks.size() > m2->blocks.size())) ||
-						// in case covered blocks are also the same, which may also happen for comparing trivial modules, compare by block area; here we simply
-						// assume that the first block is the relevant one, without further checking whether that's the only or largest one
-						((m1->cost == m2->cost) && (m1->blocks.size() == m2->blocks.size())
-						 	&& (m1->blocks.front()->bb.area < m2->blocks.front()->bb.area)
-						)
-					);
+		// a strict ordering is required, thus we have to make sure that same elements returns false
+		// http://stackoverflow.com/a/1541909
+		// also helps to make comparison short-cutting it early
+		//
+		return (m1 != m2) && (
+				// the smaller the cost the better; ascending order
+				(c1 < c2) ||
+				// in case cost are the same, which typically happens for modules being trivial (in some way to the current cost parameters),
+				// also consider the number of covered blocks, in order to prefer more larger volumes instead of trivial modules
+				((c1 == c2) && (m1->blocks.size() > m2->blocks.size())) ||
+				// in case covered blocks are also the same, which may also happen for comparing trivial modules, compare by block area; here we simply
+				// assume that the first block is the relevant one, without further checking whether that's the only or largest one
+				((c1 == c2) && (m1->blocks.size() == m2->blocks.size())
+					&& (m1->blocks.front()->bb.area < m2->blocks.front()->bb.area)
+				)
+			);
+	};
+
+	// helper to check whether a module comprises any already assigned block; such modules are invalid for further selection
+	//
+	auto invalid = [&](CompoundModule const* module) {
+
+		for (Block const* b : module->blocks) {
+
+			if (assigned_blocks[b->numerical_id] == true) {
+				return true;
+			}
+		}
+
+		return false;
+	};
+
+	// initial ordering; max-heap w/ best module on top, solely based on above set cost, i.e., without consideration of inter-volume variations (via
+	// selected_modules__power_dens_avg), but still with consideration of std dev of power densities within volumes
+	//
+	// note that std::make_heap expects a ``less'' comparator, i.e., the best module shall compare as ``largest'' element
+	std::make_heap(modules.begin(), modules.end(),
+			// lambda expression
+			[&](CompoundModule const* m1, CompoundModule const* m2) {
+				return better(m2->cost, m2, m1->cost, m1);
 			}
 		 );
 
+	assigned_blocks.assign(this->modules.begin()->second.block_ids.size(), false);
+
 	// third, stepwise select module with best cost, assign module's voltage to all
-	// related modules, remove the other (candidate) modules which comprise any of the
-	// already assigned blocks (to avoid redundant assignments with non-optimal cost
-	// for any block); proceed until all modules have been considered, which implies
-	// until all blocks have a cost-optimal voltage assignment
+	// related modules, and mark the module's blocks as assigned; other (candidate)
+	// modules which comprise any of the already assigned blocks are then lazily
+	// dropped whenever they would be considered for selection (to avoid redundant
+	// assignments with non-optimal cost for any block); proceed until all modules
+	// have been considered, which implies until all blocks have a cost-optimal
+	// voltage assignment
 	//
 	this->selected_modules.clear();
 	while (!modules.empty()) {
 
-		if (MultipleVoltages::DBG_VERBOSE) {
+		// regular case; select the module on top of the heap
+		//
+		// the look-ahead of inter-volume variations (see below) is only effective once some module has been selected
+		//
+		if (this->parameters.weight_power_variation == 0 || this->selected_modules.empty()) {
 
-			std::cout << "DBG_VOLTAGES> Current set of compound modules to be considered (in total " << modules.size() << "); view ordered by total cost (global cost and, if called for, cost for look-ahead of variance):" << std::endl;
-
-			for (auto* module : modules) {
-
-				std::cout << "DBG_VOLTAGES>  Module;" << std::endl;
-				std::cout << "DBG_VOLTAGES>   Comprised blocks #: " << module->blocks.size() << std::endl;
-				std::cout << "DBG_VOLTAGES>   Comprised blocks ids: " << module->id() << std::endl;
-				std::cout << "DBG_VOLTAGES>   Module voltages bitset: " << module->feasible_voltages << std::endl;
-				std::cout << "DBG_VOLTAGES>    (Notes: rightmost bit represents lowest voltage; last true bit to the left represents highest voltage, further false bits to the left may remain unused when fewer voltages are globally available than bits are compiled for)" << std::endl;
-				std::cout << "DBG_VOLTAGES>    Index of min voltage: " << module->min_voltage_index() << std::endl;
-				std::cout << "DBG_VOLTAGES>     (Note: read bitset above from right to left)" << std::endl;
-				std::cout << "DBG_VOLTAGES>   Module (global) cost: " << module->cost << std::endl;
-				std::cout << "DBG_VOLTAGES>    Avg gain minus ``wasted gain'' in power reduction: " << module->power_saving_avg() << std::endl;
-				std::cout << "DBG_VOLTAGES>    Avg gain in power reduction: " << module->power_saving_avg(false) << std::endl;
-				std::cout << "DBG_VOLTAGES>    Std dev of power densities: " << std::endl;
-					for (int l = 0; l < this->parameters.layers; l++) {
-						std::cout << "DBG_VOLTAGES>     On layer " << l << ": " << module->power_std_dev_[l] << std::endl;
-					}
-				std::cout << "DBG_VOLTAGES>    Estimated max number of corners for power rings: " << module->corners_powerring_max() << std::endl;
-				std::cout << "DBG_VOLTAGES>    Estimated count (upper-bound) of level shifters: " << module->level_shifter() << std::endl;
-				std::cout << "DBG_VOLTAGES>    Covered blocks: " << module->blocks.size() << std::endl;
-				std::cout << "DBG_VOLTAGES>  Power densities of this module:" << std::endl;
-					for (int l = 0; l < this->parameters.layers; l++) {
-						std::cout << "DBG_VOLTAGES>   On layer " << l << " (" << module->power_dens_avg_[l].first << " blocks): " << module->power_dens_avg_[l].second << std::endl;
+			std::pop_heap(modules.begin(), modules.end(),
+					[&](CompoundModule const* m1, CompoundModule const* m2) {
+						return better(m2->cost, m2, m1->cost, m1);
 					}
+				);
+			cur_selected_module = modules.back();
+			modules.pop_back();
 
-				std::cout << "DBG_VOLTAGES>  Power densities of modules selected so far:" << std::endl;
-					for (int l = 0; l < this->parameters.layers; l++) {
-						std::cout << "DBG_VOLTAGES>   On layer " << l << " (" << selected_modules__power_dens_avg[l].size() << " modules): ";
+			// lazy invalidation; drop module containing some already assigned blocks
+			if (invalid(cur_selected_module)) {
 
-						for (double dens : selected_modules__power_dens_avg[l]) {
-							std::cout << dens << ", ";
-						}
-						std::cout << std::endl;
-					}
+				if (MultipleVoltages::DBG_VERBOSE) {
+					std::cout << "DBG_VOLTAGES>     Module dropped, contains already assigned blocks: " << cur_selected_module->id() << std::endl;
+				}
+
+				continue;
+			}
+		}
+		// update selection if called for; the values in selected_modules__power_dens_avg have changed because of the previously selected module; so selecting any next
+		// module will have different cost
+		//
+		// only to be done when both intra-volume power variations are to be considered (parameters.weight_power_variation > 0) and when inter-volume variations shall be
+		// minimized
+		//
+		// since the look-ahead cost of all modules may change w/ each selection, a heap cannot be maintained; instead, the remaining valid modules are walked once,
+		// and the best module is selected directly
+		//
+		// (TODO) new config parameter for inter-volume variation optimization
+		else {
+			double cur_variance;
+			double c, best_c;
+			unsigned best;
+
+			// drop all modules containing some already assigned blocks
+			modules.erase(std::remove_if(modules.begin(), modules.end(), invalid), modules.end());
+
+			if (modules.empty()) {
+				break;
+			}
 
-				std::vector< std::vector<double> > selected_modules__power_dens_avg_copy = selected_modules__power_dens_avg;
+			best = 0;
+			best_c = 0.0;
+
+			for (unsigned m = 0; m < modules.size(); m++) {
+
+				cur_variance = 0.0;
+
+				// note that the look-ahead won't make sense for layers without any selected module so far; so we check each layer individually and only look-ahead
+				// for those already having at least one value assigned _and_ being affected by the module
+				//
 				for (int l = 0; l < this->parameters.layers; l++) {
 
-					if (module->power_dens_avg_[l].first > 0) {
-						selected_modules__power_dens_avg_copy[l].push_back(module->power_dens_avg_[l].second);
+					if (!selected_modules__power_dens_avg[l].empty() && modules[m]->power_dens_avg_[l].first != 0) {
+
+						selected_modules__power_dens_avg[l].push_back(modules[m]->power_dens_avg_[l].second);
+
+						// memorize only the worst/max impact
+						cur_variance = std::max(cur_variance, Math::variance(selected_modules__power_dens_avg[l]));
+
+						// remove module's value again to restore previous state
+						selected_modules__power_dens_avg[l].pop_back();
 					}
 				}
-				std::cout << "DBG_VOLTAGES>  Variance for those (selected and this module's) power densities:" << std::endl;
-					for (int l = 0; l < this->parameters.layers; l++) {
-						std::cout << "DBG_VOLTAGES>   On layer " << l << ": " << Math::variance(selected_modules__power_dens_avg_copy[l]) << std::endl;
-					}
+
+				// add weighted cost variance to previous, regular cost
+				c = modules[m]->cost + (this->parameters.weight_power_variation * cur_variance);
+
+				if (m == 0 || better(c, modules[m], best_c, modules[best])) {
+					best = m;
+					best_c = c;
+				}
 			}
-			std::cout << "DBG_VOLTAGES>" << std::endl;
-		}
 
-		// select module with currently best cost
-		cur_selected_module = *(modules.begin());
+			cur_selected_module = modules[best];
+
+			// remove selected module; order of remaining modules is not relevant
+			modules[best] = modules.back();
+			modules.pop_back();
+
+			if (MultipleVoltages::DBG_VERBOSE) {
+				std::cout << "DBG_VOLTAGES> Remaining modules re-evaluated; look-ahead cost of selected module: " << best_c << std::endl;
+			}
+		}
 
 		// memorize this module as selected
 		this->selected_modules.push_back(cur_selected_module);
@@ -332,18 +399,21 @@ std::vector<MultipleVoltages::CompoundModule*> const& MultipleVoltages::selectCo
 		}
 
 		// assign related values to all blocks comprised in this module: (index
-		// of) lowest applicable voltage, and pointer to module itself
+		// of) lowest applicable voltage, and pointer to module itself; also mark
+		// blocks as assigned
 		//
 		min_voltage_index = cur_selected_module->min_voltage_index();
 		for (Block const* b : cur_selected_module->blocks) {
 
 			b->assigned_voltage_index = min_voltage_index;
 			b->assigned_module = cur_selected_module;
+
+			assigned_blocks[b->numerical_id] = true;
 		}
 
 		if (MultipleVoltages::DBG_VERBOSE) {
 
-			std::cout << "DBG_VOLTAGES> Selected compound module (out of " << modules.size() << " modules);" << std::endl;
+			std::cout << "DBG_VOLTAGES> Selected compound module (out of " << modules.size() + 1 << " remaining modules, including already invalid modules);" << std::endl;
 			std::cout << "DBG_VOLTAGES>   Comprised blocks #: " << cur_selected_module->blocks.size() << std::endl;
 			std::cout << "DBG_VOLTAGES>   Comprised blocks ids: " << cur_selected_module->id() << std::endl;
 			std::cout << "DBG_VOLTAGES>   Module voltages bitset: " << cur_selected_module->feasible_voltages << std::endl;
@@ -378,134 +448,6 @@ std::vector<MultipleVoltages::CompoundModule*> const& MultipleVoltages::selectCo
 					std::cout << "DBG_VOLTAGES>   On layer " << l << ": " << Math::variance(selected_modules__power_dens_avg[l]) << std::endl;
 				}
 		}
-
-		// remove other modules which contain some already assigned blocks; start
-		// with 1st module in set to also remove the just considered module
-		//
-		if (MultipleVoltages::DBG_VERBOSE) {
-			count = 0;
-		}
-
-		for (auto it = modules.begin(); it != modules.end();) {
-
-			module_to_check = *it;
-			module_to_remove = false;
-
-			for (Block const* assigned_block : cur_selected_module->blocks) {
-
-				// the module to check contains a block which is assigned
-				// in the current module; thus, we drop the module
-				//
-				if (module_to_check->block_ids[assigned_block->numerical_id] == true) {
-
-					if (MultipleVoltages::DBG_VERBOSE) {
-
-						count++;
-
-						std::cout << "DBG_VOLTAGES>     Module to be deleted after selecting the module above: " << module_to_check->id() << std::endl;
-					}
-
-					// also update iterator; pointing to next element
-					// after erased element
-					it = modules.erase(it);
-					module_to_remove = true;
-
-					break;
-				}
-			}
-
-			// no module to remove; simply increment iterator
-			if (!module_to_remove) {
-				++it;
-			}
-		}
-
-		if (MultipleVoltages::DBG_VERBOSE) {
-			std::cout << "DBG_VOLTAGES>     Deleted modules count: " << count << std::endl;
-		}
-
-		// update sorting of vector if called for; the values in selected_modules__power_dens_avg have changed because of the previously selected module; so selecting any
-		// next module will have different cost
-		//
-		// only to be done when both intra-volume power variations are to be considered (parameters.weight_power_variation > 0) and when inter-volume variations shall be
-		// minimized
-		// (TODO) new config parameter for inter-volume variation optimization
-		if (this->parameters.weight_power_variation > 0) {
-
-			double m1_variance;
-			double m2_variance;
-			double c1, c2;
-			int l;
-
-			std::sort(modules.begin(), modules.end(),
-					// lambda expression; note that [&] allows to capture all variables of this scope, not only the internals of modules
-					[&](CompoundModule const* m1, CompoundModule const* m2) {
-
-						// early sanity check for strict weak ordering, same elements shall compare to false
-						if (m1 == m2) {
-							return false;
-						}
-
-						m1_variance = m2_variance = 0.0;
-
-						// note that the look-ahead won't make sense for the very first module to select; so we check each layer individually and only look-ahead for those
-						// already having at least one value assigned _and_ being affected by either m1 or m2
-						//
-						for (l = 0; l < parameters.layers; l++) {
-							if (!selected_modules__power_dens_avg[l].empty()) {
-
-								// update of c1, related to m1; only when both previously selected modules and m1 will impact this layer
-								//
-								if (m1->power_dens_avg_[l].first != 0) {
-
-									selected_modules__power_dens_avg[l].push_back( m1->power_dens_avg_[l].second );
-
-									// memorize only the worst/max impact
-									m1_variance = std::max(m1_variance, Math::variance(selected_modules__power_dens_avg[l]));
-
-									// remove m1's value again to restore previous state
-									selected_modules__power_dens_avg[l].pop_back();
-								}
-
-								// update of c2, related to m2; only when both previously selected modules and m2 will impact this layer
-								//
-								if (m2->power_dens_avg_[l].first != 0) {
-
-									selected_modules__power_dens_avg[l].push_back( m2->power_dens_avg_[l].second );
-
-									// memorize only the worst/max impact
-									m2_variance = std::max(m2_variance,Math::variance(selected_modules__power_dens_avg[l]));
-
-									// remove m2's value again to restore previous state
-									selected_modules__power_dens_avg[l].pop_back();
-								}
-							}
-						}
-						// add weighted cost variance to previous, regular cost
-						c1 = m1->cost + (parameters.weight_power_variation * m1_variance);
-						c2 = m2->cost + (parameters.weight_power_variation * m2_variance);
-
-						// return bool sorting criterion; same as further below
-						return (
-								// the smaller the cost the better; sort in ascending order
-								(c1 < c2) ||
-								// in case cost are the same, which typically happens for modules being trivial (in some way to the current cost
-								// parameters), also consider the number of covered blocks, in order to prefer more larger volumes instead of
-								// trivial modules
-								((c1 == c2) && (m1->blocks.size() > m2->blocks.size())) ||
-								// in case also the covered blocks are the same, which may also happen for comparing trivial modules, compare by
-								// block area; here we simply assume that the first block is the relevant one, without further checking whether
-								// that's the only or largest one
-								((c1 == c2) && (m1->blocks.size() == m2->blocks.size())
-								 	&& (m1->blocks.front()->bb.area < m2->blocks.front()->bb.area)
-								)
-					       );
-					});
-
-			if (MultipleVoltages::DBG_VERBOSE) {
-				std::cout << "DBG_VOLTAGES> Remaining modules resorted" << std::endl;
-			}
-		}
 	}
 
 	// fourth, merge selected modules whenever possible, i.e., when some of the
@@ -638,7 +580,7 @@ std::vector<MultipleVoltages::CompoundModule*> const& MultipleVoltages::selectCo
 	if ((this->parameters.weight_level_shifter > 0) || finalize) {
 
 		for (auto* module : this->selected_modules) {
-			module->updateLevelShifter(all_nets, false);
+			module->updateLevelShifter(this->nets_driven, false);
 		}
 	}
 	
@@ -683,6 +625,31 @@ std::vector<MultipleVoltages::CompoundModule*> const& MultipleVoltages::selectCo
 	return this->selected_modules;
 }
 
+/// index of driven nets; only nets which are relevant for level shifters are considered
+void MultipleVoltages::initNetsIndex(std::vector<Net> const& all_nets, unsigned const& block_ids_size) {
+
+	this->nets_driven.clear();
+	this->nets_driven.resize(block_ids_size);
+
+	this->nets_indexed = all_nets.data();
+	this->nets_indexed_size = all_nets.size();
+
+	for (Net const& cur_net : all_nets) {
+
+		// skip input nets, as they cannot be driven by any module
+		if (cur_net.inputNet) {
+			continue;
+		}
+
+		// skip nets with only one block (connecting with some I/O pins, or intra-block nets)
+		if (cur_net.blocks.size() == 1) {
+			continue;
+		}
+
+		this->nets_driven[cur_net.source->numerical_id].push_back(&cur_net);
+	}
+}
+
 /// stepwise consider adding single blocks into the compound module until all blocks are
 /// considered; note that this implies recursive calls to determine transitive neighbours;
 /// also note that a breadth-first search is applied to determine which is the best block
@@ -952,7 +919,7 @@ inline void MultipleVoltages::insertCompoundModuleHelper(MultipleVoltages::Compo
 	// add (pointers to) neighbours of the now additionally considered block; note
 	// that only yet not considered neighbours are effectively added
 	//
-	for (auto& n : neighbour->block->contiguous_neighbours) {
+	for (auto& n : cont.contiguousNeighbours(*neighbour->block)) {
 
 		// we have to ignore any neighbour which is already comprised in the
 		// module itself
@@ -1557,7 +1524,7 @@ std::string MultipleVoltages::CompoundModule::id() const {
 	return ret;
 };
 
-void MultipleVoltages::CompoundModule::updateLevelShifter(std::vector<Net> const& all_nets, bool upper_bound) {
+void MultipleVoltages::CompoundModule::updateLevelShifter(std::vector< std::vector<Net const*> > const& nets_driven, bool upper_bound) {
 	std::vector<Net const*> relevant_nets;
 	std::bitset<MAX_VOLTAGES> considered_voltages;
 
@@ -1574,23 +1541,15 @@ void MultipleVoltages::CompoundModule::updateLevelShifter(std::vector<Net> const
 		this->level_shifter_actual = 0;
 	}
 
-	// for each net, check whether its driver is related to this compound module
+	// consider all nets whose driver is related to this compound module; these are
+	// readily available from the index of driven nets
 	//
-	for (Net const& cur_net : all_nets) {
-
-		// skip input nets, as they cannot be driven by this module
-		if (cur_net.inputNet) {
-			continue;
-		}
-
-		// skip nets with only one block (connecting with some I/O pins, or intra-block nets)
-		if (cur_net.blocks.size() == 1) {
-			continue;
-		}
+	// note that each net has exactly one driver, thus no net is considered twice
+	//
+	for (Block const* b : this->blocks) {
 
-		// for all other nets, consider them in case their driver is within this module
-		if (this->block_ids[cur_net.source->numerical_id] == true) {
-			relevant_nets.push_back(&cur_net);
+		for (Net const* cur_net : nets_driven[b->numerical_id]) {
+			relevant_nets.push_back(cur_net);
 		}
 	}
 
@@ -185,7 +185,10 @@ class MultipleVoltages {
 			/// note that the count of level shifters is calculated in two versions; before actual top-down selection of compound modules, we shall estimate the level
 			/// shifters as upper bound (upper_bound = true), i.e., we assume that any net passing to another module requires a level shifter; after top-down selection,
 			/// we can check for the assigned voltages of different modules and thus exclude level shifters whenever the voltages are the same (upper_bound = false)
-			inline void updateLevelShifter(std::vector<Net> const& all_nets, bool upper_bound = true);
+			///
+			/// the relevant nets are looked up via the index of driven nets, see MultipleVoltages::nets_driven; this way, only the nets of comprised blocks are
+			/// walked, not all nets
+			inline void updateLevelShifter(std::vector< std::vector<Net const*> > const& nets_driven, bool upper_bound = true);
 
 			/// set global cost, required for top-down selection of modules
 			///
@@ -271,6 +274,18 @@ class MultipleVoltages {
 		/// vector of selected modules, filled by selectCompoundModules()
 		std::vector<CompoundModule*> selected_modules;
 
+		/// index of nets driven by each block; outer index is the block's numerical
+		/// id, inner vector comprises all nets which are driven by that block and
+		/// which are relevant for level shifters, i.e., nets which are not input nets
+		/// and which connect to more than one block
+		///
+		/// the index is initialized via initNetsIndex(), and rebuilt whenever the
+		/// nets container changes, see nets_indexed and resetNetsIndex()
+		std::vector< std::vector<Net const*> > nets_driven;
+		/// nets container (data and size) the index of driven nets refers to
+		Net const* nets_indexed = nullptr;
+		unsigned nets_indexed_size = 0;
+
 	// constructors, destructors, if any non-implicit
 	public:
 
@@ -278,11 +293,20 @@ class MultipleVoltages {
 	public:
 		/// helper to determine all compound modules
 		void determineCompoundModules(std::vector<Block> const& blocks, ContiguityAnalysis& contig);
+		/// helper to invalidate the index of driven nets; to be called whenever
+		/// the nets container is replaced or modified
+		inline void resetNetsIndex() {
+			this->nets_driven.clear();
+			this->nets_indexed = nullptr;
+			this->nets_indexed_size = 0;
+		}
 		/// helper to perform top-down selection of compound modules
 		std::vector<CompoundModule*> const& selectCompoundModules(std::vector<Net> const& all_nets, bool const& finalize, bool const& merge_selected_modules = false);
 
 	// private helper data, functions
 	private:
+		/// internal helper to init the index of driven nets
+		void initNetsIndex(std::vector<Net> const& all_nets, unsigned const& block_ids_size);
 		/// internal helper to recursively build up compound modules
 		void buildCompoundModulesHelper(CompoundModule& module, modules_type::iterator hint, ContiguityAnalysis& cont);
 		/// internal helper to manage compound module in data structure
@@ -42,6 +42,9 @@ void RoutingUtilization::resetUtilMaps(int const& layers) {
 		for (auto& partial_map : this->util_maps[i]) {
 			partial_map.fill(init_bin);
 		}
+		for (auto& partial_map : this->util_maps_diff[i]) {
+			partial_map.fill(0.0);
+		}
 	}
 }
 
@@ -54,12 +57,16 @@ void RoutingUtilization::initUtilMaps(int const& layers, Point const& die_outlin
 	}
 
 	this->util_maps.clear();
+	this->util_maps_diff.clear();
 
 	// allocate util-maps arrays
 	for (i = 0; i < layers; i++) {
 		this->util_maps.emplace_back(
 			std::array<std::array<RoutingUtilization::UtilBin, RoutingUtilization::UTIL_MAPS_DIM>, RoutingUtilization::UTIL_MAPS_DIM>()
 		);
+		this->util_maps_diff.emplace_back(
+			std::array<std::array<double, RoutingUtilization::UTIL_MAPS_DIM + 1>, RoutingUtilization::UTIL_MAPS_DIM + 1>()
+		);
 	}
 
 	// init maps w/ zero values
@@ -84,16 +91,35 @@ void RoutingUtilization::initUtilMaps(int const& layers, Point const& die_outlin
 	}
 }
 
-RoutingUtilization::UtilResult RoutingUtilization::determCost() const {
+RoutingUtilization::UtilResult RoutingUtilization::determCost() {
 	unsigned x, y;
 	unsigned layer;
+	double util;
 	UtilResult ret;
 
 	ret.cost = ret.avg_util = ret.max_util = 0.0;
 
 	for (layer = 0; layer < this->util_maps.size(); layer++) {
-		for (x = 0; x < this->util_maps[0].size(); x++) {
-			for (y = 0; y < this->util_maps[0][0].size(); y++) {
+
+		// materialize util map from difference array; first, sum up along
+		// y-dimension
+		for (x = 0; x < RoutingUtilization::UTIL_MAPS_DIM; x++) {
+
+			util = 0.0;
+			for (y = 0; y < RoutingUtilization::UTIL_MAPS_DIM; y++) {
+				util += this->util_maps_diff[layer][x][y];
+				this->util_maps[layer][x][y].utilization = util;
+			}
+		}
+
+		// then, sum up along x-dimension; also determine max and avg util in the
+		// same pass
+		for (x = 0; x < RoutingUtilization::UTIL_MAPS_DIM; x++) {
+			for (y = 0; y < RoutingUtilization::UTIL_MAPS_DIM; y++) {
+
+				if (x > 0) {
+					this->util_maps[layer][x][y].utilization += this->util_maps[layer][x - 1][y].utilization;
+				}
 
 				// determine max util
 				if (this->util_maps[layer][x][y].utilization > ret.max_util) {
@@ -118,7 +144,6 @@ RoutingUtilization::UtilResult RoutingUtilization::determCost() const {
 
 void RoutingUtilization::adaptUtilMap(int const& layer, Rect const& net_bb, double const& net_weight) {
 	double util;
-	unsigned x, y;
 	unsigned x_lower, x_upper, y_lower, y_upper;
 	Rect bb_ext;
 
@@ -142,6 +167,13 @@ void RoutingUtilization::adaptUtilMap(int const& layer, Rect const& net_bb, doub
 			x_upper << "," << y_upper << std::endl;
 	}
 
+	// nets (partially) outside of the util maps, e.g., for layouts exceeding the
+	// outline, are only considered for their intersection w/ the maps; nets
+	// completely outside are ignored
+	if (x_lower >= x_upper || y_lower >= y_upper) {
+		return;
+	}
+
 	// simple routing-utilization model: even distribution, as discussed in
 	// [Meister11]; this model is surprisingly accurate for practical benchmarks;
 	// calculate utilization according to wirelength, covered area, and net weight
@@ -154,14 +186,13 @@ void RoutingUtilization::adaptUtilMap(int const& layer, Rect const& net_bb, doub
 
 	util = net_weight * ((bb_ext.w + bb_ext.h) / bb_ext.area);
 
-	// walk util-map bins covering intersection; adapt routing utilization
-	for (x = x_lower; x < x_upper; x++) {
-		for (y = y_lower; y < y_upper; y++) {
-
-			// adapt map on affected layer
-			this->util_maps[layer][x][y].utilization += util;
-		}
-	}
+	// adapt routing utilization for util-map bins covering intersection; only
+	// the corners are marked in the difference array of the affected layer, the
+	// actual map is materialized in determCost()
+	this->util_maps_diff[layer][x_lower][y_lower] += util;
+	this->util_maps_diff[layer][x_upper][y_lower] -= util;
+	this->util_maps_diff[layer][x_lower][y_upper] -= util;
+	this->util_maps_diff[layer][x_upper][y_upper] += util;
 
 	if (RoutingUtilization::DBG_CALLS) {
 		std::cout << "<- RoutingUtilization::adaptPowerMaps" << std::endl;
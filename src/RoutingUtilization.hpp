@@ -60,8 +60,14 @@ class RoutingUtilization {
 	// private data, functions
 	private:
 
-		/// utilization maps [i][x][y] whereas i relates to the layer
+		/// utilization maps [i][x][y] whereas i relates to the layer; materialized
+		/// from util_maps_diff in determCost()
 		std::vector< std::array< std::array<UtilBin, UTIL_MAPS_DIM>, UTIL_MAPS_DIM> > util_maps;
+		/// difference arrays for utilization maps [i][x][y] whereas i relates to
+		/// the layer; each net's utilization is added only at the corners of its
+		/// bb, the actual maps are given by the 2D prefix sums; note the
+		/// additional bins for the upper boundaries
+		std::vector< std::array< std::array<double, UTIL_MAPS_DIM + 1>, UTIL_MAPS_DIM + 1> > util_maps_diff;
 
 		/// parameters for generating utilization maps
 		double util_maps_dim_x, util_maps_dim_y;
@@ -84,8 +90,8 @@ class RoutingUtilization {
 		void resetUtilMaps(int const& layers);
 		/// utilization analysis: handlers
 		void adaptUtilMap(int const& layer, Rect const& net_bb, double const& net_weight = 1.0);
-		/// utilization analysis: handlers
-		UtilResult determCost() const;
+		/// utilization analysis: handlers; also materializes the utilization maps
+		UtilResult determCost();
 };
 
 #endif
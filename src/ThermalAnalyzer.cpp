@@ -166,6 +166,7 @@ void ThermalAnalyzer::initPowerMaps(int const& layers, Point const& die_outline)
 
 	this->power_maps.clear();
 	this->power_maps_orig.clear();
+	this->power_maps_diff.clear();
 
 	// allocate power-maps arrays
 	for (i = 0; i < layers; i++) {
@@ -175,6 +176,9 @@ void ThermalAnalyzer::initPowerMaps(int const& layers, Point const& die_outline)
 		this->power_maps_orig.emplace_back(
 			std::array<std::array<ThermalAnalyzer::PowerMapBin, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM>()
 		);
+		this->power_maps_diff.emplace_back(
+			std::array<std::array<double, ThermalAnalyzer::POWER_MAPS_DIM + 1>, ThermalAnalyzer::POWER_MAPS_DIM + 1>()
+		);
 	}
 
 	// init the maps w/ zero values
@@ -310,9 +314,7 @@ void ThermalAnalyzer::initThermalMasks(int const& layers, bool const& log, MaskP
 void ThermalAnalyzer::generatePowerMaps(int const& layers, std::vector<Block> const& blocks, Point const& die_outline, MaskParameters const& parameters, bool const& extend_boundary_blocks_into_padding_zone) {
 	int i;
 	unsigned x, y;
-	unsigned x_lower, x_upper, y_lower, y_upper;
-	Rect bin, intersect, block_offset;
-	bool padding_zone;
+	Rect block_offset;
 	ThermalAnalyzer::PowerMapBin init_bin;
 
 	if (ThermalAnalyzer::DBG_CALLS) {
@@ -333,6 +335,9 @@ void ThermalAnalyzer::generatePowerMaps(int const& layers, std::vector<Block> co
 		for (auto& m : this->power_maps_orig[i]) {
 			m.fill(init_bin);
 		}
+		for (auto& m : this->power_maps_diff[i]) {
+			m.fill(0.0);
+		}
 
 		// consider each block on the related layer
 		for (Block const& block : blocks) {
@@ -387,68 +392,30 @@ void ThermalAnalyzer::generatePowerMaps(int const& layers, std::vector<Block> co
 				block_offset.ur.y += this->blocks_offset_y;
 			}
 
-			// determine index boundaries for offset block; based on boundary
-			// of blocks and the covered bins; note that casting truncates
-			// toward zero, i.e., performs like floor for positive numbers
-			x_lower = static_cast<unsigned>(block_offset.ll.x / this->power_maps_dim_x);
-			y_lower = static_cast<unsigned>(block_offset.ll.y / this->power_maps_dim_y);
-			// +1 in order to efficiently emulate the result of ceil(); limit
-			// upper bound to power-maps dimensions
-			x_upper = std::min(static_cast<unsigned>(block_offset.ur.x / this->power_maps_dim_x) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
-			y_upper = std::min(static_cast<unsigned>(block_offset.ur.y / this->power_maps_dim_y) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
-
-			// walk power-map bins covering block outline
-			for (x = x_lower; x < x_upper; x++) {
-				for (y = y_lower; y < y_upper; y++) {
-
-					// determine if bin w/in padding zone
-					if (
-							x < ThermalAnalyzer::POWER_MAPS_PADDED_BINS
-							|| x >= (ThermalAnalyzer::POWER_MAPS_DIM - ThermalAnalyzer::POWER_MAPS_PADDED_BINS)
-							|| y < ThermalAnalyzer::POWER_MAPS_PADDED_BINS
-							|| y >= (ThermalAnalyzer::POWER_MAPS_DIM - ThermalAnalyzer::POWER_MAPS_PADDED_BINS)
-					   ) {
-						padding_zone = true;
-					}
-					else {
-						padding_zone = false;
-					}
+			// rasterize the block's power density into the difference
+			// array; the partial coverage of the bins at the block's
+			// borders is considered there
+			this->rasterizeRect(this->power_maps_diff[i], block_offset, block.power_density());
+		}
 
-					// consider full block power density for fully covered bins
-					if (x_lower < x && x < (x_upper - 1) && y_lower < y && y < (y_upper - 1)) {
-						if (padding_zone) {
-							this->power_maps[i][x][y].power_density += block.power_density() * parameters.power_density_scaling_padding_zone;
-						}
-						else {
-							this->power_maps[i][x][y].power_density += block.power_density();
-						}
-					}
-					// else consider block power according to
-					// intersection of current bin and block
-					else {
-						// determine real coords of map bin
-						bin.ll.x = this->power_maps_bins_ll_x[x];
-						bin.ll.y = this->power_maps_bins_ll_y[y];
-						// note that +1 is guaranteed to be within bounds
-						// of power_maps_bins_ll_x/y (size =
-						// ThermalAnalyzer::POWER_MAPS_DIM + 1); the
-						// related last tuple describes the upper-right
-						// corner coordinates of the right/top boundary
-						bin.ur.x = this->power_maps_bins_ll_x[x + 1];
-						bin.ur.y = this->power_maps_bins_ll_y[y + 1];
-
-						// determine intersection
-						intersect = Rect::determineIntersection(bin, block_offset);
-						// normalize to full bin area
-						intersect.area /= this->power_maps_bin_area;
-
-						if (padding_zone) {
-							this->power_maps[i][x][y].power_density += block.power_density() * intersect.area * parameters.power_density_scaling_padding_zone;
-						}
-						else {
-							this->power_maps[i][x][y].power_density += block.power_density() * intersect.area;
-						}
-					}
+		// accumulate the difference array, i.e., materialize the power map
+		// for all blocks of this layer at once
+		this->integrateRaster(this->power_maps_diff[i]);
+
+		for (x = 0; x < ThermalAnalyzer::POWER_MAPS_DIM; x++) {
+			for (y = 0; y < ThermalAnalyzer::POWER_MAPS_DIM; y++) {
+
+				// scale bins w/in padding zone
+				if (
+						x < ThermalAnalyzer::POWER_MAPS_PADDED_BINS
+						|| x >= (ThermalAnalyzer::POWER_MAPS_DIM - ThermalAnalyzer::POWER_MAPS_PADDED_BINS)
+						|| y < ThermalAnalyzer::POWER_MAPS_PADDED_BINS
+						|| y >= (ThermalAnalyzer::POWER_MAPS_DIM - ThermalAnalyzer::POWER_MAPS_PADDED_BINS)
+				   ) {
+					this->power_maps[i][x][y].power_density = this->power_maps_diff[i][x][y] * parameters.power_density_scaling_padding_zone;
+				}
+				else {
+					this->power_maps[i][x][y].power_density = this->power_maps_diff[i][x][y];
 				}
 			}
 		}
@@ -486,12 +453,34 @@ void ThermalAnalyzer::adaptPowerMapsTSVs(int const& layers, std::vector<TSV_Isla
 	// maps; also required for HotSpot calculation, to model different material
 	// properties in regions with and without TSVs
 	//
+	for (i = 0; i < layers; i++) {
+		for (auto& m : this->power_maps_diff[i]) {
+			m.fill(0.0);
+		}
+	}
 	for (TSV_Island const& TSVi : TSVs) {
 		this->adaptPowerMapsTSVsHelper(TSVi);
 	}
 	for (TSV_Island const& TSVi : dummy_TSVs) {
 		this->adaptPowerMapsTSVsHelper(TSVi);
 	}
+	for (i = 0; i < layers; i++) {
+
+		this->integrateRaster(this->power_maps_diff[i]);
+
+		for (x = 0; x < ThermalAnalyzer::POWER_MAPS_DIM; x++) {
+			for (y = 0; y < ThermalAnalyzer::POWER_MAPS_DIM; y++) {
+				this->power_maps[i][x][y].TSV_density += this->power_maps_diff[i][x][y];
+
+				// the prefix sums may leave floating-point leftovers in
+				// bins w/o TSVs; these are cleared, since only bins w/ zero
+				// TSV density are considered as bins w/o TSVs below
+				if (std::abs(this->power_maps[i][x][y].TSV_density) < Math::epsilon) {
+					this->power_maps[i][x][y].TSV_density = 0.0;
+				}
+			}
+		}
+	}
 
 	// walk power-map bins; adapt power according to TSV densities
 	for (x = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x++) {
@@ -531,9 +520,6 @@ void ThermalAnalyzer::adaptPowerMapsTSVs(int const& layers, std::vector<TSV_Isla
 /// note that local copies of TSVs islands are used in order to not mess with the actual
 /// coordinates of the islands
 void ThermalAnalyzer::adaptPowerMapsTSVsHelper(TSV_Island TSVi) {
-	unsigned x, y;
-	unsigned x_lower, x_upper, y_lower, y_upper;
-	Rect bin, bin_intersect;
 
 	// offset intersection, i.e., account for padded power maps and related
 	// offset in coordinates
@@ -542,56 +528,101 @@ void ThermalAnalyzer::adaptPowerMapsTSVsHelper(TSV_Island TSVi) {
 	TSVi.bb.ur.x += this->blocks_offset_x;
 	TSVi.bb.ur.y += this->blocks_offset_y;
 
-	// determine index boundaries for offset intersection; based on boundary
-	// of intersection and the covered bins; note that casting truncates
-	// toward zero, i.e., performs like floor for positive numbers
-	x_lower = static_cast<unsigned>(TSVi.bb.ll.x / this->power_maps_dim_x);
-	y_lower = static_cast<unsigned>(TSVi.bb.ll.y / this->power_maps_dim_y);
-	// +1 in order to efficiently emulate the result of ceil(); limit upper
-	// bound to power-maps dimensions
-	x_upper = std::min(static_cast<unsigned>(TSVi.bb.ur.x / this->power_maps_dim_x) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
-	y_upper = std::min(static_cast<unsigned>(TSVi.bb.ur.y / this->power_maps_dim_y) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
-
 	if (ThermalAnalyzer::DBG) {
 		std::cout << "DBG> TSV group " << TSVi.id << std::endl;
-		std::cout << "DBG>  Affected power-map bins: " << x_lower << "," << y_lower
+		std::cout << "DBG>  Offset bb: " << TSVi.bb.ll.x << "," << TSVi.bb.ll.y
 			<< " to " <<
-			x_upper << "," << y_upper << std::endl;
+			TSVi.bb.ur.x << "," << TSVi.bb.ur.y << std::endl;
 	}
 
-	// walk power-map bins covering intersection outline; adapt TSV densities
-	for (x = x_lower; x < x_upper; x++) {
-		for (y = y_lower; y < y_upper; y++) {
+	// rasterize TSV density for affected layer; fully covered bins receive 100%
+	this->rasterizeRect(this->power_maps_diff[TSVi.layer], TSVi.bb, 100.0);
+}
 
-			// consider full TSV density for fully covered bins
-			if (x_lower < x && x < (x_upper - 1) && y_lower < y && y < (y_upper - 1)) {
+/// the coverage of a bin by a rectangle is separable, i.e., it is the product of the
+/// bin's coverage along x and along y; thus, a rectangle is decomposed into at most 3x3
+/// sub-rectangles of common coverage, each of which is recorded in the difference array
+/// via its four corners
+void ThermalAnalyzer::rasterizeRect(std::array< std::array<double, ThermalAnalyzer::POWER_MAPS_DIM + 1>, ThermalAnalyzer::POWER_MAPS_DIM + 1>& diff, Rect const& rect, double const& value) const {
+	std::array<ThermalAnalyzer::RasterSegment, 3> segments_x, segments_y;
+	unsigned count_x, count_y;
+	unsigned s_x, s_y;
+	double v;
 
-				// adapt map on affected layer
-				this->power_maps[TSVi.layer][x][y].TSV_density += 100.0;
-			}
-			// else consider TSV density according to partial
-			// intersection with current bin
-			else {
-				// determine real coords of map bin
-				bin.ll.x = this->power_maps_bins_ll_x[x];
-				bin.ll.y = this->power_maps_bins_ll_y[y];
-				// note that +1 is guaranteed to be within
-				// bounds of power_maps_bins_ll_x/y (size
-				// = ThermalAnalyzer::POWER_MAPS_DIM + 1);
-				// the related last tuple describes the
-				// upper-right corner coordinates of the
-				// right/top boundary
-				bin.ur.x = this->power_maps_bins_ll_x[x + 1];
-				bin.ur.y = this->power_maps_bins_ll_y[y + 1];
-
-				// determine intersection
-				bin_intersect = Rect::determineIntersection(bin, TSVi.bb);
-				// normalize to full bin area
-				bin_intersect.area /= this->power_maps_bin_area;
+	count_x = this->determineRasterSegments(rect.ll.x, rect.ur.x, this->power_maps_dim_x, this->power_maps_bins_ll_x, segments_x);
+	count_y = this->determineRasterSegments(rect.ll.y, rect.ur.y, this->power_maps_dim_y, this->power_maps_bins_ll_y, segments_y);
 
-				// adapt map on affected layer
-				this->power_maps[TSVi.layer][x][y].TSV_density += 100.0 * bin_intersect.area;
-			}
+	for (s_x = 0; s_x < count_x; s_x++) {
+		for (s_y = 0; s_y < count_y; s_y++) {
+
+			v = value * segments_x[s_x].weight * segments_y[s_y].weight;
+
+			diff[segments_x[s_x].lower][segments_y[s_y].lower] += v;
+			diff[segments_x[s_x].upper][segments_y[s_y].lower] -= v;
+			diff[segments_x[s_x].lower][segments_y[s_y].upper] -= v;
+			diff[segments_x[s_x].upper][segments_y[s_y].upper] += v;
+		}
+	}
+}
+
+unsigned ThermalAnalyzer::determineRasterSegments(double const& ll, double const& ur, double const& bin_dim, std::array<double, ThermalAnalyzer::POWER_MAPS_DIM + 1> const& bins_ll, std::array<ThermalAnalyzer::RasterSegment, 3>& segments) const {
+	unsigned lower, upper;
+	unsigned count;
+
+	// determine index boundaries; based on boundary of range and the covered
+	// bins; note that casting truncates toward zero, i.e., performs like floor for
+	// positive numbers
+	lower = static_cast<unsigned>(ll / bin_dim);
+	// +1 in order to efficiently emulate the result of ceil(); limit upper bound to
+	// power-maps dimensions
+	upper = std::min(static_cast<unsigned>(ur / bin_dim) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
+
+	// range outside of power maps
+	if (lower >= upper) {
+		return 0;
+	}
+
+	count = 0;
+
+	// first bin, partially covered; note that +1 is guaranteed to be within bounds
+	// of bins_ll (size = ThermalAnalyzer::POWER_MAPS_DIM + 1)
+	segments[count].lower = lower;
+	segments[count].upper = lower + 1;
+	segments[count].weight = std::max(0.0, std::min(ur, bins_ll[lower + 1]) - std::max(ll, bins_ll[lower])) / bin_dim;
+	count++;
+
+	// fully covered inner bins
+	if (upper - lower > 2) {
+		segments[count].lower = lower + 1;
+		segments[count].upper = upper - 1;
+		segments[count].weight = 1.0;
+		count++;
+	}
+
+	// last bin, partially covered
+	if (upper - lower > 1) {
+		segments[count].lower = upper - 1;
+		segments[count].upper = upper;
+		segments[count].weight = std::max(0.0, std::min(ur, bins_ll[upper]) - std::max(ll, bins_ll[upper - 1])) / bin_dim;
+		count++;
+	}
+
+	return count;
+}
+
+void ThermalAnalyzer::integrateRaster(std::array< std::array<double, ThermalAnalyzer::POWER_MAPS_DIM + 1>, ThermalAnalyzer::POWER_MAPS_DIM + 1>& diff) const {
+	unsigned x, y;
+
+	// prefix sums along y
+	for (x = 0; x < ThermalAnalyzer::POWER_MAPS_DIM; x++) {
+		for (y = 1; y < ThermalAnalyzer::POWER_MAPS_DIM; y++) {
+			diff[x][y] += diff[x][y - 1];
+		}
+	}
+	// prefix sums along x
+	for (x = 1; x < ThermalAnalyzer::POWER_MAPS_DIM; x++) {
+		for (y = 0; y < ThermalAnalyzer::POWER_MAPS_DIM; y++) {
+			diff[x][y] += diff[x - 1][y];
 		}
 	}
 }
@@ -693,6 +724,7 @@ void ThermalAnalyzer::performPowerBlurring(ThermalAnalysisResult& ret, int const
 	unsigned map_x, map_y;
 	unsigned mask_i;
 	double max_temp, avg_temp;
+	double power, temp;
 	// required as buffer for separated convolution; note that its dimensions
 	// corresponds to a power map, which is required to hold temporary results for 1D
 	// convolution of padded power maps
@@ -826,12 +858,31 @@ void ThermalAnalyzer::performPowerBlurring(ThermalAnalysisResult& ret, int const
 		}
 	}
 
-	// determine max and avg value
+	// determine max and avg value; also determine the sums for correlation of
+	// original power map and thermal map in the same pass, such that they are not to
+	// be derived again for leakage analysis
+	//
+	// the temperature is shifted by the offset, i.e., only the convolution's share is
+	// considered; the power is shifted by its first value
 	max_temp = avg_temp = 0.0;
+	ret.stats = {
+		this->power_maps_orig[0][0][0].power_density,
+		parameters.temp_offset,
+		0.0, 0.0, 0.0, 0.0, 0.0
+	};
 	for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
 		for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
 			max_temp = std::max(max_temp, this->thermal_map[x][y].temp);
 			avg_temp += this->thermal_map[x][y].temp;
+
+			power = this->power_maps_orig[0][x][y].power_density - ret.stats.power_shift;
+			temp = this->thermal_map[x][y].temp - ret.stats.temp_shift;
+
+			ret.stats.power_sum += power;
+			ret.stats.power_sq_sum += power * power;
+			ret.stats.temp_sum += temp;
+			ret.stats.temp_sq_sum += temp * temp;
+			ret.stats.cross_sum += power * temp;
 		}
 	}
 	avg_temp /= std::pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2);
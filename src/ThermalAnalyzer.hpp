@@ -91,10 +91,23 @@ class ThermalAnalyzer {
 			int hotspot_id;
 			std::list<ThermalMapBin*> neighbors;
 		};
+		/// sums over all bins of the power map and the thermal map of layer 0, as required for their Pearson correlation; values are shifted by reference
+		/// values, i.e., by the first power bin and by the temperature offset, which reduces the magnitude of the summed values and thus cancellation when the
+		/// sums are evaluated later on; the shifts are no means, so some cancellation remains possible for maps w/ large offsets
+		struct MapsStats {
+			double power_shift;
+			double temp_shift;
+			double power_sum;
+			double power_sq_sum;
+			double temp_sum;
+			double temp_sq_sum;
+			double cross_sum;
+		};
 		struct ThermalAnalysisResult {
 			double cost_temp;
 			double max_temp;
 			double temp_offset;
+			MapsStats stats;
 			std::array< std::array<ThermalMapBin, THERMAL_MAP_DIM>, THERMAL_MAP_DIM> *thermal_map = nullptr;
 		};
 
@@ -115,6 +128,29 @@ class ThermalAnalyzer {
 		/// whereas power_maps[0] relates to the map for layer / 0 and so forth;
 		/// same dimensions as thermal map
 		std::vector< std::array< std::array<PowerMapBin, THERMAL_MAP_DIM>, THERMAL_MAP_DIM> > power_maps_orig;
+		/// difference arrays for rasterizing blocks and TSVs into the power maps,
+		/// power_maps_diff[i][x][y] relates to the map for layer i; one more bin in
+		/// each dimension captures the upper/right borders of the rasterized
+		/// rectangles
+		std::vector< std::array< std::array<double, POWER_MAPS_DIM + 1>, POWER_MAPS_DIM + 1> > power_maps_diff;
+
+		/// rasterization helper; 1D range of power-map bins [lower, upper) w/
+		/// common coverage weight
+		struct RasterSegment {
+			unsigned lower, upper;
+			double weight;
+		};
+		/// rasterization helper; determines the (up to three) segments of bins
+		/// covered by the range [ll, ur], i.e., the partially covered first and
+		/// last bin and the fully covered bins in between; returns the number of
+		/// segments
+		unsigned determineRasterSegments(double const& ll, double const& ur, double const& bin_dim, std::array<double, POWER_MAPS_DIM + 1> const& bins_ll, std::array<RasterSegment, 3>& segments) const;
+		/// rasterization helper; adds the given value, weighted by the
+		/// fractional coverage of bins, for the rectangle to the difference array
+		void rasterizeRect(std::array< std::array<double, POWER_MAPS_DIM + 1>, POWER_MAPS_DIM + 1>& diff, Rect const& rect, double const& value) const;
+		/// rasterization helper; materializes the difference array in-place,
+		/// i.e., diff[x][y] holds the accumulated value of bin (x, y) afterwards
+		void integrateRaster(std::array< std::array<double, POWER_MAPS_DIM + 1>, POWER_MAPS_DIM + 1>& diff) const;
 		/// thermal map for layer 0 (lowest layer), i.e., hottest layer
 		std::array< std::array<ThermalMapBin, THERMAL_MAP_DIM>, THERMAL_MAP_DIM> thermal_map;
 
@@ -0,0 +1,468 @@
+/**
+ * =====================================================================================
+ *
+ *    Description:  Corblivar steady-state thermal solver; finite-volume model of the 3D-IC
+ *    stack, serves as in-process stand-in for HotSpot
+ *
+ *    Copyright (C) 2013-2016 Johann Knechtel, johann aett jknechtel dot de
+ *
+ *    This file is part of Corblivar.
+ *
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// own Corblivar header
+#include "ThermalSolver.hpp"
+// required Corblivar headers
+#include "Point.hpp"
+#include "Rect.hpp"
+#include "Block.hpp"
+#include "Math.hpp"
+
+/// memory allocation
+constexpr unsigned ThermalSolver::GRID_DIM;
+
+ThermalSolver::Result ThermalSolver::performSteadyStateSimulation(ThermalSolver::StackParameters const& parameters, std::vector<Block> const& blocks, std::vector<Block> const& wires, Point const& die_outline,
+		std::vector< std::array< std::array<ThermalAnalyzer::PowerMapBin, ThermalAnalyzer::POWER_MAPS_DIM>, ThermalAnalyzer::POWER_MAPS_DIM> > const& power_maps,
+		bool const& log) {
+	ThermalSolver::Result ret;
+
+	if (ThermalSolver::DBG_CALLS) {
+		std::cout << "-> ThermalSolver::performSteadyStateSimulation(" << &parameters << ", " << &blocks << ", " << &wires << ", " << &die_outline << ", " << &power_maps << ", " << log << ")" << std::endl;
+	}
+
+	if (log) {
+		std::cout << "ThermalSolver> Performing steady-state thermal simulation ..." << std::endl;
+	}
+
+	// each die has BEOL, active Si, passive Si and bonding layer, besides the
+	// uppermost die which has no bonding layer; the chip stack is followed by
+	// interface, spreader and heatsink
+	this->chip_layers = 4 * parameters.layers - 1;
+	this->grid_layers = this->chip_layers + 3;
+
+	this->assembleSystem(parameters, die_outline, power_maps);
+	this->assemblePower(parameters, blocks, wires, die_outline);
+
+	// (re-)initialize solution, only if the system dimensions changed; otherwise the
+	// previous solution is a reasonable initial guess
+	if (this->temp_rise.size() != this->power.size()) {
+		this->temp_rise.assign(this->power.size(), 0.0);
+	}
+
+	ret = this->solvePCG();
+
+	// determine max temp over all active Si layers
+	ret.max_temp = 0.0;
+	for (int layer = 0; layer < parameters.layers; layer++) {
+		for (unsigned x = 0; x < ThermalSolver::GRID_DIM; x++) {
+			for (unsigned y = 0; y < ThermalSolver::GRID_DIM; y++) {
+				ret.max_temp = std::max(ret.max_temp, this->getTemp(layer, x, y));
+			}
+		}
+	}
+
+	if (log) {
+		std::cout << "ThermalSolver>  PCG iterations: " << ret.iterations << "; relative residual: " << ret.residual << std::endl;
+		std::cout << "ThermalSolver>  Max temp over all active Si layers [K]: " << ret.max_temp << std::endl;
+		std::cout << "ThermalSolver> Done" << std::endl << std::endl;
+	}
+
+	if (ThermalSolver::DBG_CALLS) {
+		std::cout << "<- ThermalSolver::performSteadyStateSimulation : " << ret.max_temp << std::endl;
+	}
+
+	return ret;
+}
+
+/// conductances of the finite-volume model: between adjacent bins of the same layer, G
+/// = t * l / (d1 / k1 + d2 / k2) where d1, d2 are the half widths of the bins along the
+/// direction of heat flow, and l is the length of the common edge; between vertically
+/// adjacent bins, G = A / (t1 / (2 * k1) + t2 / (2 * k2))
+void ThermalSolver::assembleSystem(ThermalSolver::StackParameters const& parameters, Point const& die_outline,
+		std::vector< std::array< std::array<ThermalAnalyzer::PowerMapBin, ThermalAnalyzer::POWER_MAPS_DIM>, ThermalAnalyzer::POWER_MAPS_DIM> > const& power_maps) {
+	unsigned layer, x, y;
+	unsigned nodes, periphery;
+	unsigned die;
+	double w, h, dx, dy, bin_area;
+	double TSV_density;
+	double periphery_w, periphery_h;
+	double area_W_E, area_S_N;
+	double G;
+	std::vector<double> thickness;
+	std::vector< std::array< std::array<double, ThermalSolver::GRID_DIM>, ThermalSolver::GRID_DIM> > conductivity;
+	std::vector< std::vector< std::pair<unsigned, double> > > adjacency;
+	std::vector<double> diagonal;
+
+	// die and bin dimensions [m]
+	w = die_outline.x * Math::SCALE_UM_M;
+	h = die_outline.y * Math::SCALE_UM_M;
+	dx = w / ThermalSolver::GRID_DIM;
+	dy = h / ThermalSolver::GRID_DIM;
+	bin_area = dx * dy;
+
+	// thicknesses and conductivities of all grid layers; the order of chip layers
+	// follows IO::writeHotSpotFiles
+	thickness.resize(this->grid_layers);
+	conductivity.resize(this->grid_layers);
+
+	for (layer = 0; layer < this->chip_layers; layer++) {
+
+		die = layer / 4;
+
+		for (x = 0; x < ThermalSolver::GRID_DIM; x++) {
+			for (y = 0; y < ThermalSolver::GRID_DIM; y++) {
+
+				if (parameters.uniform_TSV_density) {
+					TSV_density = parameters.TSV_density;
+				}
+				else {
+					TSV_density = power_maps[die][x + ThermalAnalyzer::POWER_MAPS_PADDED_BINS][y + ThermalAnalyzer::POWER_MAPS_PADDED_BINS].TSV_density;
+				}
+
+				switch (layer % 4) {
+
+					// BEOL layer
+					case 0:
+						thickness[layer] = parameters.BEOL_thickness * Math::SCALE_UM_M;
+						conductivity[layer][x][y] = 1.0 / ThermalAnalyzer::THERMAL_RESISTIVITY_BEOL;
+						break;
+
+					// active Si layer
+					case 1:
+						thickness[layer] = parameters.Si_active_thickness * Math::SCALE_UM_M;
+						conductivity[layer][x][y] = 1.0 / ThermalAnalyzer::THERMAL_RESISTIVITY_SI;
+						break;
+
+					// passive Si layer; TSVs to be considered
+					case 2:
+						thickness[layer] = parameters.Si_passive_thickness * Math::SCALE_UM_M;
+						conductivity[layer][x][y] = 1.0 / ThermalAnalyzer::thermResSi(parameters.TSV_group_Cu_area_ratio, TSV_density);
+						break;
+
+					// bonding layer; TSVs to be considered
+					case 3:
+						thickness[layer] = parameters.bond_thickness * Math::SCALE_UM_M;
+						conductivity[layer][x][y] = 1.0 / ThermalAnalyzer::thermResBond(parameters.TSV_group_Cu_area_ratio, TSV_density);
+						break;
+				}
+			}
+		}
+	}
+
+	// package layers
+	thickness[this->chip_layers] = ThermalSolver::THICKNESS_INTERFACE;
+	thickness[this->chip_layers + 1] = ThermalSolver::THICKNESS_SPREADER;
+	thickness[this->chip_layers + 2] = ThermalSolver::THICKNESS_SINK;
+	for (x = 0; x < ThermalSolver::GRID_DIM; x++) {
+		conductivity[this->chip_layers][x].fill(ThermalSolver::CONDUCTIVITY_INTERFACE);
+		conductivity[this->chip_layers + 1][x].fill(ThermalSolver::CONDUCTIVITY_SPREADER);
+		conductivity[this->chip_layers + 2][x].fill(ThermalSolver::CONDUCTIVITY_SINK);
+	}
+
+	// init nodes; grid nodes first, peripheral nodes afterwards
+	periphery = this->grid_layers * ThermalSolver::GRID_DIM * ThermalSolver::GRID_DIM;
+	nodes = periphery + ThermalSolver::PERIPHERAL_NODES;
+
+	adjacency.clear();
+	adjacency.resize(nodes);
+	diagonal.assign(nodes, 0.0);
+
+	// helpers to add conductances between nodes and to the ambient
+	auto connect = [&](unsigned const& n1, unsigned const& n2, double const& G) {
+		adjacency[n1].push_back({n2, G});
+		adjacency[n2].push_back({n1, G});
+		diagonal[n1] += G;
+		diagonal[n2] += G;
+	};
+	auto connectAmbient = [&](unsigned const& n, double const& G) {
+		diagonal[n] += G;
+	};
+
+	/// grid nodes
+	//
+	for (layer = 0; layer < this->grid_layers; layer++) {
+		for (x = 0; x < ThermalSolver::GRID_DIM; x++) {
+			for (y = 0; y < ThermalSolver::GRID_DIM; y++) {
+
+				// lateral conductances to east and north neighbours
+				if (x < ThermalSolver::GRID_DIM - 1) {
+					G = thickness[layer] * dy / (0.5 * dx / conductivity[layer][x][y] + 0.5 * dx / conductivity[layer][x + 1][y]);
+					connect(this->node(layer, x, y), this->node(layer, x + 1, y), G);
+				}
+				if (y < ThermalSolver::GRID_DIM - 1) {
+					G = thickness[layer] * dx / (0.5 * dy / conductivity[layer][x][y] + 0.5 * dy / conductivity[layer][x][y + 1]);
+					connect(this->node(layer, x, y), this->node(layer, x, y + 1), G);
+				}
+
+				// vertical conductance to upper neighbour
+				if (layer < this->grid_layers - 1) {
+					G = bin_area / (0.5 * thickness[layer] / conductivity[layer][x][y] + 0.5 * thickness[layer + 1] / conductivity[layer + 1][x][y]);
+					connect(this->node(layer, x, y), this->node(layer + 1, x, y), G);
+				}
+			}
+		}
+	}
+
+	// secondary heat path; lumped convection resistance below lowermost BEOL layer,
+	// distributed over the bins according to their area
+	for (x = 0; x < ThermalSolver::GRID_DIM; x++) {
+		for (y = 0; y < ThermalSolver::GRID_DIM; y++) {
+			connectAmbient(this->node(0, x, y), (bin_area / (w * h)) / ThermalSolver::RESISTANCE_CONVECTION_SECONDARY);
+		}
+	}
+
+	// convection at heatsink, distributed over the sink's bins according to their
+	// area
+	for (x = 0; x < ThermalSolver::GRID_DIM; x++) {
+		for (y = 0; y < ThermalSolver::GRID_DIM; y++) {
+			connectAmbient(this->node(this->grid_layers - 1, x, y), (bin_area / std::pow(ThermalSolver::SIDE_SINK, 2.0)) / ThermalSolver::RESISTANCE_CONVECTION);
+		}
+	}
+
+	/// peripheral nodes; trapezoids of spreader and heatsink beyond the die outline
+	//
+	// widths of the spreader's trapezoids; limited to one bin for the unlikely case
+	// of dies larger than the spreader
+	periphery_w = std::max(0.5 * (ThermalSolver::SIDE_SPREADER - w), dx);
+	periphery_h = std::max(0.5 * (ThermalSolver::SIDE_SPREADER - h), dy);
+	area_W_E = periphery_w * 0.5 * (ThermalSolver::SIDE_SPREADER + h);
+	area_S_N = periphery_h * 0.5 * (ThermalSolver::SIDE_SPREADER + w);
+
+	// lateral conductances from boundary bins of spreader and heatsink to the
+	// peripheral nodes, whose centers are at half the width of the trapezoids
+	for (layer = this->chip_layers + 1; layer < this->grid_layers; layer++) {
+
+		unsigned offset = (layer == this->chip_layers + 1) ? ThermalSolver::SPREADER_W : ThermalSolver::SINK_INNER_W;
+
+		for (y = 0; y < ThermalSolver::GRID_DIM; y++) {
+			G = conductivity[layer][0][y] * thickness[layer] * dy / (0.5 * dx + 0.5 * periphery_w);
+			connect(this->node(layer, 0, y), periphery + offset + 0, G);
+			connect(this->node(layer, ThermalSolver::GRID_DIM - 1, y), periphery + offset + 1, G);
+		}
+		for (x = 0; x < ThermalSolver::GRID_DIM; x++) {
+			G = conductivity[layer][x][0] * thickness[layer] * dx / (0.5 * dy + 0.5 * periphery_h);
+			connect(this->node(layer, x, 0), periphery + offset + 2, G);
+			connect(this->node(layer, x, ThermalSolver::GRID_DIM - 1), periphery + offset + 3, G);
+		}
+	}
+
+	for (unsigned side = 0; side < 4; side++) {
+		double area_inner, area_outer, periphery_width, outer_width, edge_length;
+
+		// west and east
+		if (side < 2) {
+			area_inner = area_W_E;
+			periphery_width = periphery_w;
+		}
+		// south and north
+		else {
+			area_inner = area_S_N;
+			periphery_width = periphery_h;
+		}
+		outer_width = 0.5 * (ThermalSolver::SIDE_SINK - ThermalSolver::SIDE_SPREADER);
+		area_outer = outer_width * 0.5 * (ThermalSolver::SIDE_SINK + ThermalSolver::SIDE_SPREADER);
+		edge_length = ThermalSolver::SIDE_SPREADER;
+
+		// vertical conductance from spreader to heatsink
+		G = area_inner / (0.5 * ThermalSolver::THICKNESS_SPREADER / ThermalSolver::CONDUCTIVITY_SPREADER + 0.5 * ThermalSolver::THICKNESS_SINK / ThermalSolver::CONDUCTIVITY_SINK);
+		connect(periphery + ThermalSolver::SPREADER_W + side, periphery + ThermalSolver::SINK_INNER_W + side, G);
+
+		// lateral conductance from inner to outer heatsink nodes
+		G = ThermalSolver::CONDUCTIVITY_SINK * ThermalSolver::THICKNESS_SINK * edge_length / (0.5 * periphery_width + 0.5 * outer_width);
+		connect(periphery + ThermalSolver::SINK_INNER_W + side, periphery + ThermalSolver::SINK_OUTER_W + side, G);
+
+		// convection, according to area of heatsink nodes
+		connectAmbient(periphery + ThermalSolver::SINK_INNER_W + side, (area_inner / std::pow(ThermalSolver::SIDE_SINK, 2.0)) / ThermalSolver::RESISTANCE_CONVECTION);
+		connectAmbient(periphery + ThermalSolver::SINK_OUTER_W + side, (area_outer / std::pow(ThermalSolver::SIDE_SINK, 2.0)) / ThermalSolver::RESISTANCE_CONVECTION);
+	}
+
+	/// compressed-sparse-row format; diagonal entry first for each row
+	//
+	this->row_ptr.clear();
+	this->cols.clear();
+	this->values.clear();
+	this->row_ptr.reserve(nodes + 1);
+
+	for (unsigned n = 0; n < nodes; n++) {
+
+		this->row_ptr.push_back(this->cols.size());
+
+		this->cols.push_back(n);
+		this->values.push_back(diagonal[n]);
+
+		for (std::pair<unsigned, double> const& neighbour : adjacency[n]) {
+			this->cols.push_back(neighbour.first);
+			this->values.push_back(-neighbour.second);
+		}
+	}
+	this->row_ptr.push_back(this->cols.size());
+}
+
+/// the power of blocks and wires is assumed to be uniformly distributed over their
+/// area; blocks are located in the active Si layers, wires in the BEOL layers
+void ThermalSolver::assemblePower(ThermalSolver::StackParameters const& parameters, std::vector<Block> const& blocks, std::vector<Block> const& wires, Point const& die_outline) {
+	double dx, dy;
+
+	this->power.assign(this->grid_layers * ThermalSolver::GRID_DIM * ThermalSolver::GRID_DIM + ThermalSolver::PERIPHERAL_NODES, 0.0);
+
+	// bin dimensions [um]
+	dx = die_outline.x / ThermalSolver::GRID_DIM;
+	dy = die_outline.y / ThermalSolver::GRID_DIM;
+
+	auto distributePower = [&](Rect const& bb, unsigned const& layer, double const& power) {
+		unsigned x_lower, x_upper, y_lower, y_upper;
+		double power_density;
+
+		if (bb.area == 0.0 || power == 0.0) {
+			return;
+		}
+		power_density = power / bb.area;
+
+		// grid bins covered by the block; limited to the die outline
+		x_lower = std::min(static_cast<unsigned>(std::max(bb.ll.x, 0.0) / dx), ThermalSolver::GRID_DIM - 1);
+		x_upper = std::min(static_cast<unsigned>(std::max(bb.ur.x, 0.0) / dx), ThermalSolver::GRID_DIM - 1);
+		y_lower = std::min(static_cast<unsigned>(std::max(bb.ll.y, 0.0) / dy), ThermalSolver::GRID_DIM - 1);
+		y_upper = std::min(static_cast<unsigned>(std::max(bb.ur.y, 0.0) / dy), ThermalSolver::GRID_DIM - 1);
+
+		for (unsigned x = x_lower; x <= x_upper; x++) {
+
+			double overlap_x = std::min(bb.ur.x, (x + 1) * dx) - std::max(bb.ll.x, x * dx);
+			if (overlap_x <= 0.0) {
+				continue;
+			}
+
+			for (unsigned y = y_lower; y <= y_upper; y++) {
+
+				double overlap_y = std::min(bb.ur.y, (y + 1) * dy) - std::max(bb.ll.y, y * dy);
+				if (overlap_y <= 0.0) {
+					continue;
+				}
+
+				this->power[this->node(layer, x, y)] += power_density * overlap_x * overlap_y;
+			}
+		}
+	};
+
+	for (Block const& block : blocks) {
+
+		if (block.layer < 0 || block.layer >= parameters.layers) {
+			continue;
+		}
+
+		distributePower(block.bb, 4 * block.layer + 1, block.power());
+	}
+
+	// actual power of wires is encoded in power_density_unscaled, see
+	// ThermalAnalyzer::adaptPowerMapsWires
+	for (Block const& wire : wires) {
+
+		if (wire.layer < 0 || wire.layer >= parameters.layers) {
+			continue;
+		}
+
+		distributePower(wire.bb, 4 * wire.layer, wire.power_density_unscaled);
+	}
+}
+
+/// conjugate-gradient method w/ Jacobi preconditioner; the system matrix is symmetric
+/// and positive definite, since all nodes are (indirectly) connected to the ambient
+ThermalSolver::Result ThermalSolver::solvePCG() {
+	unsigned n, nodes;
+	unsigned i;
+	double alpha, beta;
+	double rz, rz_prev, pAp;
+	double norm_power, norm_residual;
+	std::vector<double> residual, z, p, Ap;
+	ThermalSolver::Result ret;
+
+	nodes = this->power.size();
+	residual.resize(nodes);
+	z.resize(nodes);
+	p.resize(nodes);
+	Ap.resize(nodes);
+
+	auto multiply = [&](std::vector<double> const& vector, std::vector<double>& result) {
+		for (n = 0; n < nodes; n++) {
+			double sum = 0.0;
+			for (unsigned e = this->row_ptr[n]; e < this->row_ptr[n + 1]; e++) {
+				sum += this->values[e] * vector[this->cols[e]];
+			}
+			result[n] = sum;
+		}
+	};
+	auto dot = [&](std::vector<double> const& v1, std::vector<double> const& v2) {
+		double sum = 0.0;
+		for (n = 0; n < nodes; n++) {
+			sum += v1[n] * v2[n];
+		}
+		return sum;
+	};
+
+	norm_power = std::sqrt(dot(this->power, this->power));
+
+	ret.iterations = 0;
+	ret.residual = 0.0;
+
+	// no power, trivial solution
+	if (norm_power == 0.0) {
+		std::fill(this->temp_rise.begin(), this->temp_rise.end(), 0.0);
+		return ret;
+	}
+
+	// init residual; r = b - A * x
+	multiply(this->temp_rise, Ap);
+	for (n = 0; n < nodes; n++) {
+		residual[n] = this->power[n] - Ap[n];
+		// diagonal entry is first entry for each row
+		z[n] = residual[n] / this->values[this->row_ptr[n]];
+	}
+	p = z;
+	rz = dot(residual, z);
+
+	for (i = 0; i < ThermalSolver::PCG_MAX_ITERATIONS; i++) {
+
+		norm_residual = std::sqrt(dot(residual, residual));
+		if (norm_residual <= ThermalSolver::PCG_TOLERANCE * norm_power) {
+			break;
+		}
+
+		multiply(p, Ap);
+		pAp = dot(p, Ap);
+		alpha = rz / pAp;
+
+		for (n = 0; n < nodes; n++) {
+			this->temp_rise[n] += alpha * p[n];
+			residual[n] -= alpha * Ap[n];
+			z[n] = residual[n] / this->values[this->row_ptr[n]];
+		}
+
+		rz_prev = rz;
+		rz = dot(residual, z);
+		beta = rz / rz_prev;
+
+		for (n = 0; n < nodes; n++) {
+			p[n] = z[n] + beta * p[n];
+		}
+	}
+
+	ret.iterations = i;
+	ret.residual = std::sqrt(dot(residual, residual)) / norm_power;
+
+	if (ThermalSolver::DBG) {
+		std::cout << "DBG_THERMAL_SOLVER> PCG iterations: " << ret.iterations << "; relative residual: " << ret.residual << std::endl;
+	}
+
+	return ret;
+}
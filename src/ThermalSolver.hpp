@@ -0,0 +1,186 @@
+/**
+ * =====================================================================================
+ *
+ *    Description:  Corblivar steady-state thermal solver; finite-volume model of the 3D-IC
+ *    stack, serves as in-process stand-in for HotSpot
+ *
+ *    Copyright (C) 2013-2016 Johann Knechtel, johann aett jknechtel dot de
+ *
+ *    This file is part of Corblivar.
+ *
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_THERMAL_SOLVER
+#define _CORBLIVAR_THERMAL_SOLVER
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+#include "ThermalAnalyzer.hpp"
+// forward declarations, if any
+class Block;
+class Point;
+
+/// Corblivar steady-state thermal solver
+///
+/// the 3D-IC stack is modeled as in IO::writeHotSpotFiles, i.e., for each die there
+/// are BEOL, active Si, passive Si, and bonding layers (the latter not for the
+/// uppermost die), where the conductivities of passive Si and bonding layers depend on
+/// the TSV densities; the stack is followed by the thermal interface material, heat
+/// spreader and heatsink; all these layers are discretized by the same grid as the
+/// thermal map, and the parts of spreader and heatsink which are extending beyond the
+/// die outline are modeled by peripheral nodes, similar to HotSpot's grid model; the
+/// secondary heat path through the package is modeled as lumped convection
+/// resistance below the lowermost BEOL layer
+///
+/// the resulting linear system for the temperature rise over the ambient temperature
+/// is solved w/ a preconditioned conjugate-gradient method
+class ThermalSolver {
+	private:
+		/// debugging code switch (private)
+		static constexpr bool DBG = false;
+		/// debugging code switch (private)
+		static constexpr bool DBG_CALLS = false;
+
+	// public data
+	public:
+		/// package parameters, as in exp/hotspot_heatsink.config; ambient
+		/// temperature [K]
+		static constexpr double AMBIENT_TEMP = 293.0;
+		/// package parameters, as in exp/hotspot_heatsink.config; thermal
+		/// interface material; thickness [m] and conductivity [W/(m*K)]
+		static constexpr double THICKNESS_INTERFACE = 2.0e-05;
+		/// package parameters, as in exp/hotspot_heatsink.config
+		static constexpr double CONDUCTIVITY_INTERFACE = 4.0;
+		/// package parameters, as in exp/hotspot_heatsink.config; heat
+		/// spreader; side [m], thickness [m] and conductivity [W/(m*K)]
+		static constexpr double SIDE_SPREADER = 0.03;
+		/// package parameters, as in exp/hotspot_heatsink.config
+		static constexpr double THICKNESS_SPREADER = 0.001;
+		/// package parameters, as in exp/hotspot_heatsink.config
+		static constexpr double CONDUCTIVITY_SPREADER = 400.0;
+		/// package parameters, as in exp/hotspot_heatsink.config; heatsink;
+		/// side [m], thickness [m] and conductivity [W/(m*K)]
+		static constexpr double SIDE_SINK = 0.06;
+		/// package parameters, as in exp/hotspot_heatsink.config
+		static constexpr double THICKNESS_SINK = 0.0069;
+		/// package parameters, as in exp/hotspot_heatsink.config
+		static constexpr double CONDUCTIVITY_SINK = 400.0;
+		/// package parameters, as in exp/hotspot_heatsink.config; convection
+		/// resistance [K/W] of heatsink
+		static constexpr double RESISTANCE_CONVECTION = 0.1;
+		/// package parameters, as in exp/hotspot_heatsink.config; convection
+		/// resistance [K/W] of secondary heat path
+		static constexpr double RESISTANCE_CONVECTION_SECONDARY = 50.0;
+
+		/// solver parameters; convergence criterion, relative to the norm of
+		/// the power vector
+		static constexpr double PCG_TOLERANCE = 1.0e-10;
+		/// solver parameters
+		static constexpr unsigned PCG_MAX_ITERATIONS = 10000;
+
+		/// grid dimensions, same as for the thermal map
+		static constexpr unsigned GRID_DIM = ThermalAnalyzer::THERMAL_MAP_DIM;
+
+	// PODs, to be declared early on
+	public:
+		/// POD for parameters of the 3D-IC stack; thicknesses are given in [um]
+		struct StackParameters {
+			int layers;
+			double BEOL_thickness;
+			double Si_active_thickness;
+			double Si_passive_thickness;
+			double bond_thickness;
+			double TSV_group_Cu_area_ratio;
+			/// flag whether to consider one common TSV density for the whole
+			/// chip, as for thermal-analysis fitting runs, or the TSV densities
+			/// of the power maps' bins
+			bool uniform_TSV_density;
+			double TSV_density;
+		};
+		/// POD for overall result
+		struct Result {
+			double max_temp;
+			unsigned iterations;
+			double residual;
+		};
+		/// peripheral nodes of spreader and heatsink, for west, east, south and
+		/// north side; inner nodes of heatsink are below the spreader's
+		/// peripheral nodes, outer nodes are beyond the spreader
+		enum PeripheralNodes : unsigned {
+			SPREADER_W, SPREADER_E, SPREADER_S, SPREADER_N,
+			SINK_INNER_W, SINK_INNER_E, SINK_INNER_S, SINK_INNER_N,
+			SINK_OUTER_W, SINK_OUTER_E, SINK_OUTER_S, SINK_OUTER_N,
+			PERIPHERAL_NODES
+		};
+
+	// private data, functions
+	private:
+		/// layers of the grid, i.e., chip layers, interface, spreader and sink
+		unsigned grid_layers;
+		/// layers of the chip stack
+		unsigned chip_layers;
+
+		/// linear system in compressed-sparse-row format; conductances between
+		/// the nodes
+		std::vector<unsigned> row_ptr, cols;
+		/// linear system in compressed-sparse-row format; conductances between
+		/// the nodes
+		std::vector<double> values;
+		/// power dissipated in the nodes
+		std::vector<double> power;
+		/// temperature rise over ambient temperature, i.e., the solution; also
+		/// serves as initial guess for the next run
+		std::vector<double> temp_rise;
+
+		/// helper to index nodes of the grid
+		inline unsigned node(unsigned const& layer, unsigned const& x, unsigned const& y) const {
+			return (layer * GRID_DIM + x) * GRID_DIM + y;
+		};
+
+		/// solver helper; assembles the linear system
+		void assembleSystem(StackParameters const& parameters, Point const& die_outline,
+				std::vector< std::array< std::array<ThermalAnalyzer::PowerMapBin, ThermalAnalyzer::POWER_MAPS_DIM>, ThermalAnalyzer::POWER_MAPS_DIM> > const& power_maps);
+		/// solver helper; distributes the power of blocks over the grid bins of
+		/// the related layer
+		void assemblePower(StackParameters const& parameters, std::vector<Block> const& blocks, std::vector<Block> const& wires, Point const& die_outline);
+		/// solver helper; preconditioned conjugate-gradient method
+		Result solvePCG();
+
+	// constructors, destructors, if any non-implicit
+	public:
+
+	// public data, functions
+	public:
+		/// thermal simulation: handler; the TSV densities are considered from the
+		/// (padded) power maps, unless a uniform TSV density is defined
+		Result performSteadyStateSimulation(StackParameters const& parameters, std::vector<Block> const& blocks, std::vector<Block> const& wires, Point const& die_outline,
+				std::vector< std::array< std::array<ThermalAnalyzer::PowerMapBin, ThermalAnalyzer::POWER_MAPS_DIM>, ThermalAnalyzer::POWER_MAPS_DIM> > const& power_maps,
+				bool const& log = false);
+
+		/// resets the solution, i.e., the next simulation starts w/o initial
+		/// guess from any previous run; required where results must not depend
+		/// on the order of simulations, e.g., for parallel sampling
+		inline void resetSolution() {
+			this->temp_rise.clear();
+		};
+
+		/// getter; temperature [K] of the active Si layer of given die, for
+		/// given grid bin; the bins are the same as for the thermal map
+		inline double getTemp(int const& layer, unsigned const& x, unsigned const& y) const {
+			return this->temp_rise[this->node(4 * layer + 1, x, y)] + ThermalSolver::AMBIENT_TEMP;
+		};
+};
+
+#endif
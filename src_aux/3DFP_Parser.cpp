@@ -104,7 +104,7 @@ void parse3DFP(FloorPlanner& fp) {
 				break;
 
 			// try to find related block
-			block = Block::findBlock(tmpstr, fp.getBlocks());
+			block = Block::findBlock(tmpstr, fp.getBlocks(), fp.getBlocksIds());
 			if (block == nullptr) {
 				std::cout << "Block parsed from 3DFP file cannot be found, block id: " << tmpstr << std::endl;
 				exit(1);
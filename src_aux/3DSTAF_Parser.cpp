@@ -133,7 +133,7 @@ void parse3DSTAF(FloorPlanner& fp) {
 		}
 
 		// try to find related block
-		block = Block::findBlock(blocks[id].id, fp.getBlocks());
+		block = Block::findBlock(blocks[id].id, fp.getBlocks(), fp.getBlocksIds());
 		if (block == nullptr) {
 			std::cout << "Block parsed from 3DSTAF file cannot be found, block id: " << tmpstr << std::endl;
 			exit(1);
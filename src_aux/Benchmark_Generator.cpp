@@ -0,0 +1,487 @@
+/*
+ * =====================================================================================
+ *
+ *    Description: Generator for synthetic benchmarks in GSRC format, for stress and scaling tests
+ *
+ *    Copyright (C) 2013-2016 Johann Knechtel, johann aett jknechtel dot de
+ *
+ *    This file is part of Corblivar.
+ *
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// required Corblivar headers
+#include "../src/Corblivar.incl.hpp"
+#include <random>
+
+// logging flags
+static constexpr bool DBG = false;
+
+// parameters of the benchmark; all can be set via command line as parameter=value, the
+// defaults resemble the GSRC benchmarks
+struct Parameters {
+	// count of blocks
+	unsigned blocks;
+	// ratio of soft blocks; all other blocks are hard blocks
+	double soft = 0.0;
+	// block sizes; the side lengths [um] are log-normal distributed w/ given median
+	// and std dev of the log, i.e., sigma = 0.0 results in equal block sizes
+	double size_median = 40.0;
+	double size_sigma = 0.3;
+	// block sizes; max aspect ratio, for both hard and soft blocks
+	double AR_max = 3.0;
+	// ratio of large macros, i.e., of blocks scaled by macro_scale in both dimensions
+	double macros = 0.0;
+	double macro_scale = 5.0;
+	// count of nets, as ratio of the block count
+	double nets = 9.0;
+	// avg net degree, i.e., avg count of blocks per net, at least 2; the degrees are
+	// geometrically distributed, up to degree_max
+	double degree = 2.1;
+	unsigned degree_max = 32;
+	// locality of nets; the blocks of a net are drawn from a window around a random
+	// block, the window size is given as ratio of the block count; 1.0 for random
+	// nets w/o locality
+	double locality = 0.05;
+	// count of terminal pins, as ratio of the block count; each pin is connected to
+	// one net
+	double terminals = 1.0;
+	// power densities [uW/um^2]; log-normal distributed w/ given mean and std dev of
+	// the log, i.e., spread = 0.0 results in equal power densities
+	double power_mean = 3.0;
+	double power_spread = 0.5;
+	// alignment density, i.e., ratio of blocks covered by alignment requests; the
+	// requests are defined for pairs of blocks
+	double alignments = 0.0;
+	// die count and deadspace, the latter as ratio of the die area; only for the
+	// suggested die outline, not for the benchmark itself
+	int dies = 2;
+	double deadspace = 0.3;
+	// seed for random numbers; fixed by default, for reproducible benchmarks
+	unsigned seed = 0;
+};
+
+// block of the benchmark
+struct Block {
+	std::string id;
+	bool soft;
+	double w, h;
+	double power_density;
+};
+
+// forward declaration
+void parseParameters(int const& argc, char** argv, std::string& benchmark, Parameters& parameters);
+void writeBlocks(std::string const& benchmark, std::vector<Block> const& blocks, unsigned const& terminals, double const& AR_max);
+void writePlacement(std::string const& benchmark, std::vector<Block> const& blocks, unsigned const& terminals, double const& outline);
+void writePower(std::string const& benchmark, std::vector<Block> const& blocks);
+void writeNets(std::string const& benchmark, std::vector< std::vector<std::string> > const& nets);
+void writeAlignments(std::string const& benchmark, std::vector<Block> const& blocks, std::vector<unsigned> const& aligned_blocks, std::mt19937& generator);
+
+int main (int argc, char** argv) {
+	std::string benchmark;
+	Parameters parameters;
+	std::vector<Block> blocks;
+	std::vector< std::vector<std::string> > nets;
+	std::vector<unsigned> aligned_blocks;
+	unsigned terminals, net_count, degree, center, window, pins;
+	double side, AR, area, outline;
+
+	std::cout << std::endl;
+	std::cout << "Synthetic Benchmark Generator" << std::endl;
+	std::cout << "-----------------------------" << std::endl;
+	std::cout << std::endl;
+
+	parseParameters(argc, argv, benchmark, parameters);
+
+	std::mt19937 generator(parameters.seed);
+	std::uniform_real_distribution<double> uniform(0.0, 1.0);
+	std::normal_distribution<double> normal(0.0, 1.0);
+
+	/// blocks
+	//
+	blocks.reserve(parameters.blocks);
+	area = 0.0;
+
+	for (unsigned b = 0; b < parameters.blocks; b++) {
+		Block block;
+
+		block.id = "sb" + std::to_string(b);
+		block.soft = uniform(generator) < parameters.soft;
+
+		// side length of square block w/ same area, and aspect ratio
+		side = parameters.size_median * std::exp(parameters.size_sigma * normal(generator));
+		if (uniform(generator) < parameters.macros) {
+			side *= parameters.macro_scale;
+		}
+		AR = std::exp((2.0 * uniform(generator) - 1.0) * std::log(parameters.AR_max));
+
+		// integer dimensions, as in GSRC benchmarks
+		block.w = std::max(1.0, std::round(side * std::sqrt(AR)));
+		block.h = std::max(1.0, std::round(side / std::sqrt(AR)));
+
+		// log-normal power density w/ given mean
+		block.power_density = parameters.power_mean * std::exp(parameters.power_spread * normal(generator) - 0.5 * parameters.power_spread * parameters.power_spread);
+
+		area += block.w * block.h;
+
+		blocks.push_back(std::move(block));
+	}
+
+	/// nets
+	//
+	net_count = std::round(parameters.nets * parameters.blocks);
+	window = std::max(2u, static_cast<unsigned>(std::round(parameters.locality * parameters.blocks)));
+	window = std::min(window, parameters.blocks);
+
+	// geometric distribution for net degrees, shifted by 2
+	std::geometric_distribution<unsigned> degree_distribution(1.0 / std::max(1.0, parameters.degree - 1.0));
+
+	nets.resize(net_count);
+	for (std::vector<std::string>& net : nets) {
+
+		degree = std::min(2 + degree_distribution(generator), std::min(parameters.degree_max, window));
+
+		// blocks w/in window around random center; no block repeated
+		center = std::uniform_int_distribution<unsigned>(0, parameters.blocks - 1)(generator);
+		std::set<unsigned> net_blocks;
+		while (net_blocks.size() < degree) {
+			net_blocks.insert((center + parameters.blocks - window / 2 + std::uniform_int_distribution<unsigned>(0, window - 1)(generator)) % parameters.blocks);
+		}
+
+		for (unsigned const& b : net_blocks) {
+			net.push_back(blocks[b].id);
+		}
+	}
+
+	// terminal pins; each pin is connected to one random net, as the net's first
+	// element, i.e., as input net, or as further element, i.e., as output net
+	terminals = std::round(parameters.terminals * parameters.blocks);
+	pins = 0;
+	if (!nets.empty()) {
+		for (unsigned p = 1; p <= terminals; p++) {
+			std::vector<std::string>& net = nets[std::uniform_int_distribution<unsigned>(0, nets.size() - 1)(generator)];
+
+			if (uniform(generator) < 0.5) {
+				net.insert(net.begin(), "p" + std::to_string(p));
+			}
+			else {
+				net.push_back("p" + std::to_string(p));
+			}
+		}
+	}
+	for (std::vector<std::string> const& net : nets) {
+		pins += net.size();
+	}
+
+	/// alignment requests, for pairs of randomly drawn blocks
+	//
+	aligned_blocks.resize(parameters.blocks);
+	for (unsigned b = 0; b < parameters.blocks; b++) {
+		aligned_blocks[b] = b;
+	}
+	std::shuffle(aligned_blocks.begin(), aligned_blocks.end(), generator);
+	aligned_blocks.resize(2 * static_cast<unsigned>(std::round(parameters.alignments * parameters.blocks / 2.0)));
+
+	/// output
+	//
+	// suggested die outline; also used for the pins' placement
+	outline = std::ceil(std::sqrt(area / ((1.0 - parameters.deadspace) * parameters.dies)));
+
+	writeBlocks(benchmark, blocks, terminals, parameters.AR_max);
+	writePlacement(benchmark, blocks, terminals, outline);
+	writePower(benchmark, blocks);
+	writeNets(benchmark, nets);
+	writeAlignments(benchmark, blocks, aligned_blocks, generator);
+
+	std::cout << "Generator> Blocks: " << blocks.size() << "; overall area [um^2]: " << area << std::endl;
+	std::cout << "Generator> Nets: " << nets.size() << "; pins: " << pins << "; terminal pins: " << terminals << std::endl;
+	std::cout << "Generator> Alignment requests: " << aligned_blocks.size() / 2 << std::endl;
+	std::cout << "Generator> Suggested fixed die outline for " << parameters.dies << " dies and " << 100.0 * parameters.deadspace << "% deadspace [um]: " << outline << " x " << outline << std::endl;
+	std::cout << "Generator> Done; files written: " << benchmark << ".blocks, .pl, .power, .nets, .alr" << std::endl;
+	std::cout << std::endl;
+}
+
+void parseParameters(int const& argc, char** argv, std::string& benchmark, Parameters& parameters) {
+	std::string parameter, value;
+	size_t pos;
+
+	// print command-line parameters
+	if (argc < 3) {
+		std::cout << "Generator> Usage: " << argv[0] << " benchmark_name blocks [parameter=value ...]" << std::endl;
+		std::cout << "Generator> " << std::endl;
+		std::cout << "Generator> Mandatory parameter ``benchmark_name'': name for the benchmark files, i.e., BENCH.blocks, BENCH.pl, BENCH.power, BENCH.nets, BENCH.alr" << std::endl;
+		std::cout << "Generator> Mandatory parameter ``blocks'': count of blocks" << std::endl;
+		std::cout << "Generator> Optional parameters, w/ their defaults:" << std::endl;
+		std::cout << "Generator>  soft=0.0 -- ratio of soft blocks" << std::endl;
+		std::cout << "Generator>  size_median=40.0 size_sigma=0.3 -- log-normal distribution of block side lengths [um]" << std::endl;
+		std::cout << "Generator>  AR_max=3.0 -- max aspect ratio of blocks" << std::endl;
+		std::cout << "Generator>  macros=0.0 macro_scale=5.0 -- ratio of large macros, and their scaling of side lengths" << std::endl;
+		std::cout << "Generator>  nets=9.0 -- count of nets, as ratio of the block count" << std::endl;
+		std::cout << "Generator>  degree=2.1 degree_max=32 -- avg and max count of blocks per net" << std::endl;
+		std::cout << "Generator>  locality=0.05 -- window for blocks of a net, as ratio of the block count; 1.0 for random nets" << std::endl;
+		std::cout << "Generator>  terminals=1.0 -- count of terminal pins, as ratio of the block count" << std::endl;
+		std::cout << "Generator>  power_mean=3.0 power_spread=0.5 -- log-normal distribution of power densities [uW/um^2]" << std::endl;
+		std::cout << "Generator>  alignments=0.0 -- ratio of blocks covered by alignment requests" << std::endl;
+		std::cout << "Generator>  dies=2 deadspace=0.3 -- for suggested die outline" << std::endl;
+		std::cout << "Generator>  seed=0 -- seed for random numbers" << std::endl;
+		exit(1);
+	}
+
+	benchmark = argv[1];
+	parameters.blocks = atoi(argv[2]);
+
+	if (parameters.blocks < 2) {
+		std::cout << "Generator> At least 2 blocks are required" << std::endl;
+		exit(1);
+	}
+
+	for (int i = 3; i < argc; i++) {
+		parameter = argv[i];
+		pos = parameter.find('=');
+
+		if (pos == std::string::npos) {
+			std::cout << "Generator> Parameter not given as parameter=value: " << parameter << std::endl;
+			exit(1);
+		}
+
+		value = parameter.substr(pos + 1);
+		parameter = parameter.substr(0, pos);
+
+		if (parameter == "soft") {
+			parameters.soft = atof(value.c_str());
+		}
+		else if (parameter == "size_median") {
+			parameters.size_median = atof(value.c_str());
+		}
+		else if (parameter == "size_sigma") {
+			parameters.size_sigma = atof(value.c_str());
+		}
+		else if (parameter == "AR_max") {
+			parameters.AR_max = std::max(1.0, atof(value.c_str()));
+		}
+		else if (parameter == "macros") {
+			parameters.macros = atof(value.c_str());
+		}
+		else if (parameter == "macro_scale") {
+			parameters.macro_scale = atof(value.c_str());
+		}
+		else if (parameter == "nets") {
+			parameters.nets = atof(value.c_str());
+		}
+		else if (parameter == "degree") {
+			parameters.degree = std::max(2.0, atof(value.c_str()));
+		}
+		else if (parameter == "degree_max") {
+			parameters.degree_max = std::max(2, atoi(value.c_str()));
+		}
+		else if (parameter == "locality") {
+			parameters.locality = atof(value.c_str());
+		}
+		else if (parameter == "terminals") {
+			parameters.terminals = atof(value.c_str());
+		}
+		else if (parameter == "power_mean") {
+			parameters.power_mean = atof(value.c_str());
+		}
+		else if (parameter == "power_spread") {
+			parameters.power_spread = atof(value.c_str());
+		}
+		else if (parameter == "alignments") {
+			parameters.alignments = std::min(1.0, atof(value.c_str()));
+		}
+		else if (parameter == "dies") {
+			parameters.dies = std::max(1, atoi(value.c_str()));
+		}
+		else if (parameter == "deadspace") {
+			parameters.deadspace = std::min(0.9, std::max(0.0, atof(value.c_str())));
+		}
+		else if (parameter == "seed") {
+			parameters.seed = atoi(value.c_str());
+		}
+		else {
+			std::cout << "Generator> Unknown parameter: " << parameter << std::endl;
+			exit(1);
+		}
+	}
+
+	if (DBG) {
+		std::cout << "DBG_GENERATOR> Benchmark: " << benchmark << "; blocks: " << parameters.blocks << "; seed: " << parameters.seed << std::endl;
+	}
+}
+
+void writeBlocks(std::string const& benchmark, std::vector<Block> const& blocks, unsigned const& terminals, double const& AR_max) {
+	std::ofstream out;
+	unsigned soft_blocks;
+
+	soft_blocks = 0;
+	for (Block const& block : blocks) {
+		if (block.soft) {
+			soft_blocks++;
+		}
+	}
+
+	out.open((benchmark + ".blocks").c_str());
+
+	out << "UCSC blocks 1.0" << "\n";
+	out << "# Created      : Benchmark_Generator" << "\n";
+	out << "\n";
+	out << "NumSoftRectangularBlocks : " << soft_blocks << "\n";
+	out << "NumHardRectilinearBlocks : " << blocks.size() - soft_blocks << "\n";
+	out << "NumTerminals : " << terminals << "\n";
+	out << "\n";
+
+	for (Block const& block : blocks) {
+
+		if (block.soft) {
+			out << block.id << " softrectangular " << block.w * block.h << " " << 1.0 / AR_max << " " << AR_max << "\n";
+		}
+		else {
+			out << block.id << " hardrectilinear 4 (0, 0) (0, " << block.h << ") (" << block.w << ", " << block.h << ") (" << block.w << ", 0)" << "\n";
+		}
+	}
+
+	out << "\n";
+
+	for (unsigned p = 1; p <= terminals; p++) {
+		out << "p" << p << " terminal" << "\n";
+	}
+
+	out.close();
+}
+
+void writePlacement(std::string const& benchmark, std::vector<Block> const& blocks, unsigned const& terminals, double const& outline) {
+	std::ofstream out;
+	double pos;
+
+	out.open((benchmark + ".pl").c_str());
+
+	out << "UCLA pl 1.0" << "\n";
+	out << "\n";
+
+	// blocks are not placed
+	for (Block const& block : blocks) {
+		out << block.id << "\t0\t0" << "\n";
+	}
+
+	out << "\n";
+
+	// terminal pins are evenly spread along the outline, counter-clockwise from the
+	// lower-left corner
+	for (unsigned p = 1; p <= terminals; p++) {
+
+		pos = 4.0 * outline * (p - 1) / terminals;
+
+		out << "p" << p << "\t";
+
+		if (pos < outline) {
+			out << std::round(pos) << "\t0";
+		}
+		else if (pos < 2.0 * outline) {
+			out << outline << "\t" << std::round(pos - outline);
+		}
+		else if (pos < 3.0 * outline) {
+			out << std::round(3.0 * outline - pos) << "\t" << outline;
+		}
+		else {
+			out << "0\t" << std::round(4.0 * outline - pos);
+		}
+
+		out << "\n";
+	}
+
+	out.close();
+}
+
+void writePower(std::string const& benchmark, std::vector<Block> const& blocks) {
+	std::ofstream out;
+
+	out.open((benchmark + ".power").c_str());
+
+	out << "# power density in 10^6 W/m^2 = uW/um^2 end" << "\n";
+
+	for (Block const& block : blocks) {
+		out << block.power_density << "\n";
+	}
+
+	out.close();
+}
+
+void writeNets(std::string const& benchmark, std::vector< std::vector<std::string> > const& nets) {
+	std::ofstream out;
+	unsigned pins;
+
+	pins = 0;
+	for (std::vector<std::string> const& net : nets) {
+		pins += net.size();
+	}
+
+	out.open((benchmark + ".nets").c_str());
+
+	out << "UCLA nets 1.0" << "\n";
+	out << "# Created      : Benchmark_Generator" << "\n";
+	out << "\n";
+	out << "NumNets : " << nets.size() << "\n";
+	out << "NumPins : " << pins << "\n";
+
+	for (std::vector<std::string> const& net : nets) {
+
+		out << "NetDegree : " << net.size() << "\n";
+
+		for (std::string const& pin : net) {
+			out << pin << " B" << "\n";
+		}
+	}
+
+	out.close();
+}
+
+void writeAlignments(std::string const& benchmark, std::vector<Block> const& blocks, std::vector<unsigned> const& aligned_blocks, std::mt19937& generator) {
+	std::ofstream out;
+
+	out.open((benchmark + ".alr").c_str());
+
+	out << "# Alignment-Requests File for Corblivar" << "\n";
+	out << "#" << "\n";
+	out << "# Generated by Benchmark_Generator; see the shipped benchmarks, e.g., n100.alr, for" << "\n";
+	out << "# the format of requests" << "\n";
+	out << "#" << "\n";
+	out << "# ( STRICT_FLEXIBLE SIGNALS BLOCK_1 BLOCK_2 TYPE_X ALIGNMENT_X TYPE_Y ALIGNMENT_Y )" << "\n";
+	out << "#" << "\n";
+	out << "# data_start" << "\n";
+	out << "\n";
+
+	// the same kinds of requests as in the shipped benchmarks: vertical buses, i.e.,
+	// strict min overlaps, and flexible buses w/ no preferred orientation, i.e., min
+	// overlap and max distance
+	for (unsigned r = 0; r + 1 < aligned_blocks.size(); r += 2) {
+
+		out << "( ";
+
+		switch (std::uniform_int_distribution<unsigned>(0, 2)(generator)) {
+			case 0:
+				out << "STRICT 1024 " << blocks[aligned_blocks[r]].id << " " << blocks[aligned_blocks[r + 1]].id << " MIN 50.0 MIN 50.0";
+				break;
+			case 1:
+				out << "FLEXIBLE 1024 " << blocks[aligned_blocks[r]].id << " " << blocks[aligned_blocks[r + 1]].id << " MAX 2000.0 MIN 50.0";
+				break;
+			default:
+				out << "FLEXIBLE 1024 " << blocks[aligned_blocks[r]].id << " " << blocks[aligned_blocks[r + 1]].id << " MIN 50.0 MAX 2000.0";
+				break;
+		}
+
+		out << " )" << "\n";
+	}
+
+	out.close();
+}
@@ -0,0 +1,527 @@
+/*
+ * =====================================================================================
+ *
+ *    Description: Calibrates the parameters of Corblivar's power-blurring thermal analysis, i.e., the thermal-mask and power-maps parameters, against the in-process thermal solver
+ *
+ *    Copyright (C) 2013-2016 Johann Knechtel, johann aett jknechtel dot de
+ *
+ *    This file is part of Corblivar.
+ *
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// required Corblivar headers
+#include "../src/CorblivarCore.hpp"
+#include "../src/FloorPlanner.hpp"
+#include "../src/IO.hpp"
+#include <random>
+#include <thread>
+#include <atomic>
+#include <mutex>
+
+// logging flags
+static constexpr bool DBG = false;
+
+// global fixed parameters
+// independent Nelder-Mead runs; the first run starts from the parameters of the config
+// file, the others from randomly perturbed parameters
+static constexpr unsigned RUNS = 16;
+// threads for parallel runs; 0 refers to the number of hardware threads
+static constexpr unsigned THREADS = 0;
+// seed for the perturbation of initial parameters; fixed for reproducible results
+static constexpr unsigned SEED = 0;
+// limit for iterations of each Nelder-Mead run
+static constexpr unsigned MAX_ITERATIONS = 1000;
+// convergence criterion; relative spread of cost values over the simplex
+static constexpr double TOLERANCE = 1.0e-8;
+// relative size of the initial simplex
+static constexpr double INIT_STEP = 0.2;
+// std dev for the perturbation of initial parameters, relative to the parameter values
+static constexpr double PERTURBATION = 0.5;
+// upper limit for power-density scaling factor in padding zone; same as in
+// thermal_analysis_octave/parameters.m
+static constexpr double MAX_POWER_DENSITY_SCALING_PADDING_ZONE = 2.0;
+
+// parameters to be calibrated: impulse factor, impulse-scaling factor, mask-boundary
+// value, power-density scaling factors for padding zone and TSV regions; the
+// temperature offset is derived for each candidate separately
+static constexpr unsigned DIM = 5;
+
+// type definitions, for shorter notation
+typedef std::array<double, DIM> parameters_type;
+typedef std::array< std::array<double, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> temp_map_type;
+
+// result of one Nelder-Mead run
+struct CalibrationResult {
+	parameters_type parameters;
+	double temp_offset;
+	double cost;
+	unsigned iterations;
+};
+
+// thread-local evaluation context; the layout, power maps and reference thermal map
+// remain in memory, only the power maps and masks are re-generated for each candidate
+struct CalibrationContext {
+	FloorPlanner const& fp;
+	temp_map_type const& reference;
+	ThermalAnalyzer thermalAnalyzer;
+	std::vector<Block> wires;
+	unsigned evaluations = 0;
+
+	CalibrationContext(FloorPlanner const& fp, temp_map_type const& reference) :
+		fp(fp),
+		reference(reference),
+		thermalAnalyzer(fp.getThermalAnalyzer()),
+		wires(fp.getWires()) {
+	}
+};
+
+// forward declaration
+ThermalAnalyzer::MaskParameters toMaskParameters(FloorPlanner const& fp, parameters_type const& parameters);
+bool feasible(parameters_type const& parameters);
+double evaluate(CalibrationContext& context, parameters_type const& parameters, double& temp_offset);
+CalibrationResult runNelderMead(CalibrationContext& context, parameters_type const& init_parameters);
+
+int main (int argc, char** argv) {
+	FloorPlanner fp;
+	temp_map_type reference;
+	parameters_type config_parameters;
+	std::vector<parameters_type> init_parameters;
+	std::vector<CalibrationResult> results;
+	std::vector<std::thread> threads;
+	std::atomic<unsigned> next_run(0);
+	std::mutex log_mutex;
+	unsigned thread_count;
+	unsigned best;
+	double temp_offset;
+	double max_error, max_temp, max_temp_reference;
+
+	std::cout << std::endl;
+	std::cout << "Power-Blurring Thermal Analysis: Calibration of Thermal-Mask and Power-Maps Parameters" << std::endl;
+	std::cout << "--------------------------------------------------------------------------------------" << std::endl;
+	std::cout << std::endl;
+
+	// parse program parameter, config file, and further files
+	IO::parseParametersFiles(fp, argc, argv);
+	// parse blocks
+	IO::parseBlocks(fp);
+	// parse nets
+	IO::parseNets(fp);
+
+	// generate DAG (directed acyclic graph) for SL-STA (system-level static timing analysis)
+	fp.initTimingPowerAnalyser();
+
+	// init Corblivar core
+	CorblivarCore corb = CorblivarCore(fp.getLayers(), fp.getBlocks().size());
+
+	// parse alignment request
+	IO::parseAlignmentRequests(fp, corb.editAlignments());
+
+	// init thermal analyzer, only reasonable after parsing config file
+	fp.initThermalAnalyzer();
+
+	// init routing-utilization analyzer
+	fp.initRoutingUtilAnalyzer();
+
+	// no solution file found; error
+	if (!fp.inputSolutionFileOpen()) {
+		std::cout << "Corblivar> ";
+		std::cout << "ERROR: Solution file required for call of " << argv[0] << std::endl << std::endl;
+		exit(1);
+	}
+
+	// required solution file found; parse from file, and generate layout and all data such as power and thermal maps
+	//
+	// read from file
+	IO::parseCorblivarFile(fp, corb);
+
+	// assume read in data as currently best solution
+	corb.storeBestCBLs();
+
+	// overall cost is not determined; cost cannot be determined since no
+	// normalization during SA search was performed
+	//
+	// generates also all required files
+	fp.finalize(corb, false);
+	std::cout << std::endl;
+
+	// determine reference thermal map, i.e., the active Si layer of the lowermost
+	// die, the same as represented by Corblivar's thermal map
+	//
+	fp.performThermalSimulation(true);
+
+	for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
+		for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+			reference[x][y] = fp.getThermalSolver().getTemp(0, x, y);
+		}
+	}
+
+	// initial parameters; first run starts from the config file's parameters, the
+	// others from randomly perturbed parameters; log-normal perturbation keeps the
+	// parameters positive
+	//
+	config_parameters = {
+		fp.getPowerBlurringParameters().impulse_factor,
+		fp.getPowerBlurringParameters().impulse_factor_scaling_exponent,
+		fp.getPowerBlurringParameters().mask_boundary_value,
+		fp.getPowerBlurringParameters().power_density_scaling_padding_zone,
+		fp.getPowerBlurringParameters().power_density_scaling_TSV_region
+	};
+
+	std::default_random_engine random_generator(SEED);
+	std::normal_distribution<double> gaussian(0.0, PERTURBATION);
+
+	init_parameters.push_back(config_parameters);
+
+	while (init_parameters.size() < RUNS) {
+		parameters_type parameters;
+
+		for (unsigned i = 0; i < DIM; i++) {
+			parameters[i] = config_parameters[i] * std::exp(gaussian(random_generator));
+		}
+
+		// limit to feasible range; note that perturbed parameters may still be
+		// infeasible, e.g., for the mask-boundary value, and are then redrawn
+		parameters[3] = std::max(1.0, std::min(MAX_POWER_DENSITY_SCALING_PADDING_ZONE, parameters[3]));
+		parameters[4] = std::min(1.0, parameters[4]);
+
+		if (feasible(parameters)) {
+			init_parameters.push_back(parameters);
+		}
+	}
+
+	// parallel Nelder-Mead runs; each thread works on its own evaluation context,
+	// and each run's result is stored in its own slot; thus the overall result is
+	// independent of the number of threads and their scheduling
+	//
+	if (THREADS > 0) {
+		thread_count = THREADS;
+	}
+	else {
+		thread_count = std::max(1u, std::thread::hardware_concurrency());
+	}
+	thread_count = std::min(thread_count, RUNS);
+
+	{
+		CalibrationContext context(fp, reference);
+		std::cout << "Calibration> Parameters of config file: cost (mean squared error [K^2]): " << evaluate(context, config_parameters, temp_offset) << std::endl;
+	}
+	std::cout << "Calibration> Nelder-Mead runs: " << RUNS << "; threads: " << thread_count << std::endl;
+	std::cout << std::endl;
+
+	results.resize(RUNS);
+
+	auto calibrate = [&]() {
+		CalibrationContext context(fp, reference);
+		unsigned run;
+
+		while ((run = next_run++) < RUNS) {
+
+			results[run] = runNelderMead(context, init_parameters[run]);
+
+			std::lock_guard<std::mutex> lock(log_mutex);
+			std::cout << "Calibration> Run " << run << ": cost (mean squared error [K^2]): " << results[run].cost;
+			std::cout << "; iterations: " << results[run].iterations << std::endl;
+		}
+	};
+
+	for (unsigned t = 0; t < thread_count; t++) {
+		threads.emplace_back(calibrate);
+	}
+	for (std::thread& t : threads) {
+		t.join();
+	}
+
+	// determine best run; ties are resolved by run index
+	//
+	best = 0;
+	for (unsigned run = 1; run < RUNS; run++) {
+		if (results[run].cost < results[best].cost) {
+			best = run;
+		}
+	}
+
+	// evaluate the best parameters once more, for reporting
+	//
+	CalibrationContext context(fp, reference);
+	evaluate(context, results[best].parameters, temp_offset);
+
+	ThermalAnalyzer::ThermalAnalysisResult thermal_analysis;
+	ThermalAnalyzer::MaskParameters mask_parameters = toMaskParameters(fp, results[best].parameters);
+	mask_parameters.temp_offset = temp_offset;
+	context.thermalAnalyzer.performPowerBlurring(thermal_analysis, fp.getLayers(), mask_parameters);
+
+	max_error = max_temp_reference = 0.0;
+	for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
+		for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+			max_error = std::max(max_error, std::abs((*thermal_analysis.thermal_map)[x][y].temp - reference[x][y]));
+			max_temp_reference = std::max(max_temp_reference, reference[x][y]);
+		}
+	}
+	max_temp = thermal_analysis.max_temp;
+
+	std::cout << std::endl;
+	std::cout << "Calibration results (best run: " << best << ")" << std::endl;
+	std::cout << "-------------------------------" << std::endl;
+	std::cout << "Mean squared error [K^2]: " << results[best].cost << std::endl;
+	std::cout << "Max absolute error [K]: " << max_error << std::endl;
+	std::cout << "Max temp (thermal solver) [K]: " << max_temp_reference << std::endl;
+	std::cout << "Max temp (power blurring) [K]: " << max_temp << std::endl;
+	std::cout << std::endl;
+	std::cout << "Parameters for config file, section \"Power blurring (thermal analysis)\":" << std::endl;
+	std::cout << "# Impulse factor I" << std::endl;
+	std::cout << mask_parameters.impulse_factor << std::endl;
+	std::cout << "# Impulse-scaling factor If" << std::endl;
+	std::cout << mask_parameters.impulse_factor_scaling_exponent << std::endl;
+	std::cout << "# Mask-boundary value" << std::endl;
+	std::cout << mask_parameters.mask_boundary_value << std::endl;
+	std::cout << "# Power-density scaling factor in padding zone" << std::endl;
+	std::cout << mask_parameters.power_density_scaling_padding_zone << std::endl;
+	std::cout << "# Power-density down-scaling factor for TSV regions" << std::endl;
+	std::cout << mask_parameters.power_density_scaling_TSV_region << std::endl;
+	std::cout << "# Temperature offset" << std::endl;
+	std::cout << mask_parameters.temp_offset << std::endl;
+	std::cout << std::endl;
+}
+
+ThermalAnalyzer::MaskParameters toMaskParameters(FloorPlanner const& fp, parameters_type const& parameters) {
+	ThermalAnalyzer::MaskParameters mask_parameters = fp.getPowerBlurringParameters();
+
+	mask_parameters.impulse_factor = parameters[0];
+	mask_parameters.impulse_factor_scaling_exponent = parameters[1];
+	mask_parameters.mask_boundary_value = parameters[2];
+	mask_parameters.power_density_scaling_padding_zone = parameters[3];
+	mask_parameters.power_density_scaling_TSV_region = parameters[4];
+
+	return mask_parameters;
+}
+
+// feasible parameters; same constraints as for parsing the config file, see
+// IO::parseParametersFiles, and as in thermal_analysis_octave/optimization.m
+bool feasible(parameters_type const& parameters) {
+
+	return
+		// impulse factor
+		parameters[0] > 0.0
+		// impulse-scaling factor
+		&& parameters[1] > 0.0
+		// mask-boundary value, has to be smaller than impulse factor
+		&& parameters[2] > 0.0 && parameters[2] < parameters[0]
+		// power-density scaling factor in padding zone
+		&& parameters[3] >= 1.0 && parameters[3] <= MAX_POWER_DENSITY_SCALING_PADDING_ZONE
+		// power-density down-scaling factor for TSV regions
+		&& parameters[4] >= 0.0 && parameters[4] <= 1.0;
+}
+
+// cost: mean squared error of power-blurring thermal map and reference thermal map;
+// the temperature offset is an additive term, thus its optimum is derived directly as
+// avg difference of both maps, and returned by reference
+double evaluate(CalibrationContext& context, parameters_type const& parameters, double& temp_offset) {
+	ThermalAnalyzer::MaskParameters mask_parameters;
+	ThermalAnalyzer::ThermalAnalysisResult thermal_analysis;
+	FloorPlanner const& fp = context.fp;
+	double diff, cost;
+	unsigned bins;
+
+	if (!feasible(parameters)) {
+		return std::numeric_limits<double>::infinity();
+	}
+
+	context.evaluations++;
+
+	mask_parameters = toMaskParameters(fp, parameters);
+	mask_parameters.temp_offset = 0.0;
+
+	// re-generate power maps, considering the wires and TSVs as well, and the thermal
+	// masks; see FloorPlanner::evaluateInterconnects and
+	// FloorPlanner::evaluateThermalDistr
+	context.thermalAnalyzer.generatePowerMaps(fp.getLayers(), fp.getBlocks(), fp.getOutline(), mask_parameters);
+	if (!context.wires.empty()) {
+		context.thermalAnalyzer.adaptPowerMapsWires(context.wires);
+	}
+	context.thermalAnalyzer.adaptPowerMapsTSVs(fp.getLayers(), fp.getTSVs(), fp.getDummyTSVs(), mask_parameters);
+	context.thermalAnalyzer.initThermalMasks(fp.getLayers(), false, mask_parameters);
+
+	context.thermalAnalyzer.performPowerBlurring(thermal_analysis, fp.getLayers(), mask_parameters);
+
+	// derive temperature offset
+	bins = ThermalAnalyzer::THERMAL_MAP_DIM * ThermalAnalyzer::THERMAL_MAP_DIM;
+	temp_offset = 0.0;
+	for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
+		for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+			temp_offset += context.reference[x][y] - (*thermal_analysis.thermal_map)[x][y].temp;
+		}
+	}
+	temp_offset /= bins;
+
+	// determine error
+	cost = 0.0;
+	for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
+		for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+			diff = (*thermal_analysis.thermal_map)[x][y].temp + temp_offset - context.reference[x][y];
+			cost += diff * diff;
+		}
+	}
+	cost /= bins;
+
+	// the masks would be ill-defined for NaN parameters
+	if (std::isnan(cost)) {
+		return std::numeric_limits<double>::infinity();
+	}
+
+	return cost;
+}
+
+// Nelder-Mead downhill simplex w/ standard coefficients; infeasible candidates are
+// assigned infinite cost and are thus rejected
+CalibrationResult runNelderMead(CalibrationContext& context, parameters_type const& init_parameters) {
+	static constexpr double REFLECTION = 1.0;
+	static constexpr double EXPANSION = 2.0;
+	static constexpr double CONTRACTION = 0.5;
+	static constexpr double SHRINKAGE = 0.5;
+
+	std::array<parameters_type, DIM + 1> simplex;
+	std::array<double, DIM + 1> costs;
+	std::array<unsigned, DIM + 1> order;
+	parameters_type centroid, reflected, expanded, contracted;
+	double cost_reflected, cost_expanded, cost_contracted;
+	double temp_offset;
+	unsigned iteration;
+	CalibrationResult ret;
+
+	// lambda helper; point along the line from the centroid through the worst point
+	auto along = [&](parameters_type const& worst, double const& coefficient) {
+		parameters_type p;
+		for (unsigned i = 0; i < DIM; i++) {
+			p[i] = centroid[i] + coefficient * (centroid[i] - worst[i]);
+		}
+		return p;
+	};
+
+	// init simplex; the initial point and one point for each dimension, shifted by a
+	// relative step; the step is reversed when leaving the feasible range
+	simplex[0] = init_parameters;
+	for (unsigned i = 0; i < DIM; i++) {
+		simplex[i + 1] = init_parameters;
+		simplex[i + 1][i] += INIT_STEP * std::max(std::abs(init_parameters[i]), 0.1);
+
+		if (!feasible(simplex[i + 1])) {
+			simplex[i + 1][i] = init_parameters[i] - INIT_STEP * std::max(std::abs(init_parameters[i]), 0.1);
+		}
+	}
+	for (unsigned i = 0; i <= DIM; i++) {
+		costs[i] = evaluate(context, simplex[i], temp_offset);
+	}
+
+	for (iteration = 0; iteration < MAX_ITERATIONS; iteration++) {
+
+		// order simplex points by cost; ties are resolved by index, for determinism
+		for (unsigned i = 0; i <= DIM; i++) {
+			order[i] = i;
+		}
+		std::stable_sort(order.begin(), order.end(), [&](unsigned const& i1, unsigned const& i2) {
+			return costs[i1] < costs[i2];
+		});
+
+		unsigned best = order[0];
+		unsigned worst = order[DIM];
+		unsigned second_worst = order[DIM - 1];
+
+		if (DBG) {
+			std::cout << "DBG_CALIBRATION> Iteration " << iteration << "; best cost: " << costs[best] << std::endl;
+		}
+
+		// convergence check; relative spread of costs
+		if (std::isfinite(costs[worst]) && costs[worst] - costs[best] <= TOLERANCE * (std::abs(costs[best]) + TOLERANCE)) {
+			break;
+		}
+
+		// centroid of all points but the worst
+		centroid.fill(0.0);
+		for (unsigned i = 0; i <= DIM; i++) {
+			if (i == worst) {
+				continue;
+			}
+			for (unsigned j = 0; j < DIM; j++) {
+				centroid[j] += simplex[i][j] / DIM;
+			}
+		}
+
+		// reflection
+		reflected = along(simplex[worst], REFLECTION);
+		cost_reflected = evaluate(context, reflected, temp_offset);
+
+		if (cost_reflected < costs[best]) {
+
+			// expansion
+			expanded = along(simplex[worst], EXPANSION);
+			cost_expanded = evaluate(context, expanded, temp_offset);
+
+			if (cost_expanded < cost_reflected) {
+				simplex[worst] = expanded;
+				costs[worst] = cost_expanded;
+			}
+			else {
+				simplex[worst] = reflected;
+				costs[worst] = cost_reflected;
+			}
+		}
+		else if (cost_reflected < costs[second_worst]) {
+			simplex[worst] = reflected;
+			costs[worst] = cost_reflected;
+		}
+		else {
+			// contraction; outside if the reflected point is better than the
+			// worst one, inside otherwise
+			if (cost_reflected < costs[worst]) {
+				contracted = along(simplex[worst], CONTRACTION);
+			}
+			else {
+				contracted = along(simplex[worst], -CONTRACTION);
+			}
+			cost_contracted = evaluate(context, contracted, temp_offset);
+
+			if (cost_contracted < std::min(cost_reflected, costs[worst])) {
+				simplex[worst] = contracted;
+				costs[worst] = cost_contracted;
+			}
+			// shrinkage towards the best point
+			else {
+				for (unsigned i = 0; i <= DIM; i++) {
+					if (i == best) {
+						continue;
+					}
+					for (unsigned j = 0; j < DIM; j++) {
+						simplex[i][j] = simplex[best][j] + SHRINKAGE * (simplex[i][j] - simplex[best][j]);
+					}
+					costs[i] = evaluate(context, simplex[i], temp_offset);
+				}
+			}
+		}
+	}
+
+	// determine best point
+	unsigned best = 0;
+	for (unsigned i = 1; i <= DIM; i++) {
+		if (costs[i] < costs[best]) {
+			best = i;
+		}
+	}
+
+	ret.parameters = simplex[best];
+	ret.cost = evaluate(context, ret.parameters, ret.temp_offset);
+	ret.iterations = iteration;
+
+	return ret;
+}
@@ -25,6 +25,7 @@
 #include "../src/CorblivarCore.hpp"
 #include "../src/FloorPlanner.hpp"
 #include "../src/IO.hpp"
+#include "Sampling_TSC.hpp"
 #include <random>
 #include <chrono>
 
@@ -34,21 +35,24 @@ static constexpr bool DBG_PARSING = false;
 
 // global fixed parameters
 static constexpr unsigned SAMPLING_ITERATIONS = 10;
+// threads for parallel sampling; 0 refers to the number of hardware threads
+static constexpr unsigned SAMPLING_THREADS = 0;
 // for the Gaussian distribution of power values; the std dev is set up from the mean value and this factor
 static constexpr double MEAN_TO_STD_DEV_FACTOR = 0.1;
 // for dummy TSV insertion, consider all bins with correlations above this fraction of the worst correlation per layer
 static constexpr double MAX_CORR_RANGE = 0.99;
+// run external HotSpot via HotSpot.sh, or the in-process thermal solver; the latter
+// is not validated against HotSpot yet, thus HotSpot is run by default
+static constexpr bool HOTSPOT_EXTERNAL = true;
 
 // type definitions, for shorter notation
-typedef	std::array< std::array< std::array<double, SAMPLING_ITERATIONS> , ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> samples_data_layer_type;
-typedef	std::vector< samples_data_layer_type > samples_data_type;
 typedef std::array< std::array<double, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> correlations_layer_type;
 // copied from Variation_TSC
 typedef	std::array< std::array<ThermalAnalyzer::ThermalMapBin, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> thermal_maps_layer_type;
 typedef	std::vector< thermal_maps_layer_type > thermal_maps_type;
 
 // forward declaration
-void parseHotSpotFiles(FloorPlanner& fp, unsigned sampling_iter, samples_data_type& temp_samples);
+void parseHotSpotFiles(FloorPlanner& fp, sample_type& temp_sample);
 void writeHotSpotPtrace(FloorPlanner& fp);
 void writeHotSpotFiles__passiveSi_bonding(FloorPlanner& fp);
 // copied and adapted from Variation_TSC
@@ -57,12 +61,10 @@ void parseHotSpotFiles(FloorPlanner& fp, std::string const& benchmark_suffix, th
 int main (int argc, char** argv) {
 	FloorPlanner fp;
 
-	samples_data_type temp_samples;
-	samples_data_type power_samples;
+	SamplingStatistics statistics;
 
 	double avg_power, avg_temp;
 	double std_dev_power, std_dev_temp;
-	double cur_power_dev, cur_temp_dev;
 
 	double cov;
 
@@ -151,90 +153,106 @@ int main (int argc, char** argv) {
 	run = true;
 	while (run) {
 
-		// clear local samples_data_type
+		// reset statistics and correlations
 		//
-		power_samples.clear();
-		temp_samples.clear();
+		statistics.reset(fp.getLayers());
 		correlations.clear();
 
 		// allocate vectors
 		for (int layer = 0; layer < fp.getLayers(); layer++) {
 
-			power_samples.emplace_back(samples_data_layer_type());
-			temp_samples.emplace_back(samples_data_layer_type());
 			correlations.emplace_back(correlations_layer_type());
 		}
 
 		// generate power data and gather related HotSpot simulation temperature data
 		//
-		for (unsigned sampling_iter = 0; sampling_iter < SAMPLING_ITERATIONS; sampling_iter++) {
+		// the in-process thermal solver allows for parallel sampling
+		if (!HOTSPOT_EXTERNAL) {
+			sampleParallel(fp, random_generator(), SAMPLING_ITERATIONS, SAMPLING_THREADS, MEAN_TO_STD_DEV_FACTOR, statistics);
 
-			std::cout << std::endl;
-			std::cout << "Sampling iteration: " << (sampling_iter + 1) << "/" << SAMPLING_ITERATIONS << std::endl;
-			std::cout << "------------------------------" << std::endl;
+			// the sequential sampling implicitly re-generates the power maps;
+			// this is required here as well, since the TSV densities are
+			// adapted below
+			fp.editThermalAnalyzer().generatePowerMaps(fp.getLayers(), fp.getBlocks(), fp.getOutline(), fp.getPowerBlurringParameters());
+		}
+		// the external HotSpot runs are working on shared files, thus sampling has to
+		// be sequential
+		else {
+			sample_type power_sample(fp.getLayers());
+			sample_type temp_sample(fp.getLayers());
 
-			// first, randomly vary power densities in blocks
-			//
-			for (Block const& b : fp.getBlocks()) {
+			for (unsigned sampling_iter = 0; sampling_iter < SAMPLING_ITERATIONS; sampling_iter++) {
 
-				// restore original value, used as mean for Gaussian distribution of power densities
-				b.power_density_unscaled = b.power_density_unscaled_back;
+				std::cout << std::endl;
+				std::cout << "Sampling iteration: " << (sampling_iter + 1) << "/" << SAMPLING_ITERATIONS << std::endl;
+				std::cout << "------------------------------" << std::endl;
 
-				// calculate new power value, based on Gaussian distribution
-				std::normal_distribution<double> gaussian(b.power_density_unscaled, b.power_density_unscaled * MEAN_TO_STD_DEV_FACTOR);
+				// first, randomly vary power densities in blocks
+				//
+				for (Block const& b : fp.getBlocks()) {
 
-				b.power_density_unscaled = gaussian(random_generator);
+					// restore original value, used as mean for Gaussian distribution of power densities
+					b.power_density_unscaled = b.power_density_unscaled_back;
 
-				if (DBG) {
-					std::cout << "Block " << b.id << ":" << std::endl;
-					std::cout << " Original power = " << b.power_density_unscaled_back << std::endl;
-					std::cout << " New random power = " << b.power_density_unscaled << std::endl;
-				}
-			}
-
-			// second, generate new power maps
-			//
-			fp.editThermalAnalyzer().generatePowerMaps(fp.getLayers(), fp.getBlocks(), fp.getOutline(), fp.getPowerBlurringParameters());
+					// calculate new power value, based on Gaussian distribution
+					std::normal_distribution<double> gaussian(b.power_density_unscaled, b.power_density_unscaled * MEAN_TO_STD_DEV_FACTOR);
 
-			// copy data from Corblivar power maps into local data structure power_samples
-			//
-			for (int layer = 0; layer < fp.getLayers(); layer++) {
-				for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-					for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+					b.power_density_unscaled = gaussian(random_generator);
 
-						power_samples[layer][x][y][sampling_iter] = fp.getThermalAnalyzer().getPowerMapsOrig()[layer][x][y].power_density;
+					if (DBG) {
+						std::cout << "Block " << b.id << ":" << std::endl;
+						std::cout << " Original power = " << b.power_density_unscaled_back << std::endl;
+						std::cout << " New random power = " << b.power_density_unscaled << std::endl;
 					}
 				}
-			}
 
-			// third, run HotSpot on this new map
-			//
-			// generate new ptrace file first
-			writeHotSpotPtrace(fp);
-			// HotSpot.sh system call
-			system(std::string("./HotSpot.sh " + fp.getBenchmark() + " " + std::to_string(fp.getLayers())).c_str());
+				// second, generate new power maps
+				//
+				fp.editThermalAnalyzer().generatePowerMaps(fp.getLayers(), fp.getBlocks(), fp.getOutline(), fp.getPowerBlurringParameters());
 
-			// fourth, read in the new HotSpot results into local data structure temp_samples
-			//
-			parseHotSpotFiles(fp, sampling_iter, temp_samples);
+				// copy data from Corblivar power maps into local data structure power_sample
+				//
+				for (int layer = 0; layer < fp.getLayers(); layer++) {
+					for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
+						for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
 
+							power_sample[layer][x][y] = fp.getThermalAnalyzer().getPowerMapsOrig()[layer][x][y].power_density;
+						}
+					}
+				}
 
-			if (DBG) {
-				std::cout << "Printing gathered power/temperature data for sampling iteration " << sampling_iter << std::endl;
-				std::cout << std::endl;
+				// third, run HotSpot on this new map
+				//
+				// generate new ptrace file first
+				writeHotSpotPtrace(fp);
+				// HotSpot.sh system call
+				system(std::string("./HotSpot.sh " + fp.getBenchmark() + " " + std::to_string(fp.getLayers())).c_str());
 
-				for (int layer = 0; layer < fp.getLayers(); layer++) {
-					std::cout << " Layer " << layer << std::endl;
+				// fourth, read in the new HotSpot results into local data structure temp_sample
+				//
+				parseHotSpotFiles(fp, temp_sample);
+
+				if (DBG) {
+					std::cout << "Printing gathered power/temperature data for sampling iteration " << sampling_iter << std::endl;
 					std::cout << std::endl;
 
-					for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-						for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+					for (int layer = 0; layer < fp.getLayers(); layer++) {
+						std::cout << " Layer " << layer << std::endl;
+						std::cout << std::endl;
+
+						for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
+							for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
 
-							std::cout << "  Power[" << x << "][" << y << "]: " << power_samples[layer][x][y][sampling_iter] << std::endl;
-							std::cout << "  Temp [" << x << "][" << y << "]: " << temp_samples[layer][x][y][sampling_iter] << std::endl;
+								std::cout << "  Power[" << x << "][" << y << "]: " << power_sample[layer][x][y] << std::endl;
+								std::cout << "  Temp [" << x << "][" << y << "]: " << temp_sample[layer][x][y] << std::endl;
+							}
 						}
 					}
 				}
+
+				// fifth, update the statistics
+				//
+				statistics.add(power_sample, temp_sample);
 			}
 		}
 
@@ -267,19 +285,10 @@ int main (int argc, char** argv) {
 			for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
 				for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
 
-					avg_power = avg_temp = 0.0;
-					cov = std_dev_power = std_dev_temp = 0.0;
-					corr = 0.0;
+					BinStatistics const& bin = statistics.bins[layer][x][y];
 
-					// first pass: determine avg values
-					//
-					for (unsigned sampling_iter = 0; sampling_iter < SAMPLING_ITERATIONS; sampling_iter++) {
-
-						avg_power += power_samples[layer][x][y][sampling_iter];
-						avg_temp += temp_samples[layer][x][y][sampling_iter];
-					}
-					avg_power /= SAMPLING_ITERATIONS;
-					avg_temp /= SAMPLING_ITERATIONS;
+					avg_power = bin.avg_power;
+					avg_temp = bin.avg_temp;
 
 					// dbg output
 					if (DBG) {
@@ -287,28 +296,12 @@ int main (int argc, char** argv) {
 						std::cout << " Avg power: " << avg_power << std::endl;
 						std::cout << " Avg temp: " << avg_temp << std::endl;
 					}
-					
-					// second pass: determine covariance and standard deviations
-					//
-					for (unsigned sampling_iter = 0; sampling_iter < SAMPLING_ITERATIONS; sampling_iter++) {
-
-						// deviations of current values from avg values
-						cur_power_dev = power_samples[layer][x][y][sampling_iter] - avg_power;
-						cur_temp_dev = temp_samples[layer][x][y][sampling_iter] - avg_temp;
-
-						// covariance
-						cov += cur_power_dev * cur_temp_dev;
-
-						// standard deviation, calculate its sqrt later on
-						std_dev_power += std::pow(cur_power_dev, 2.0);
-						std_dev_temp += std::pow(cur_temp_dev, 2.0);
-					}
-					cov /= SAMPLING_ITERATIONS;
-					std_dev_power /= SAMPLING_ITERATIONS;
-					std_dev_temp /= SAMPLING_ITERATIONS;
 
-					std_dev_power = std::sqrt(std_dev_power);
-					std_dev_temp = std::sqrt(std_dev_temp);
+					// covariance and standard deviations
+					//
+					cov = bin.co_dev / statistics.count;
+					std_dev_power = std::sqrt(bin.sq_dev_power / statistics.count);
+					std_dev_temp = std::sqrt(bin.sq_dev_temp / statistics.count);
 
 					// calculate Pearson correlation: covariance over product of standard deviations
 					//
@@ -528,7 +521,9 @@ int main (int argc, char** argv) {
 	IO::writeHotSpotFiles(fp);
 
 	// final HotSpot.sh system call for original files
-	system(std::string("./HotSpot.sh " + fp.getBenchmark() + " " + std::to_string(fp.getLayers())).c_str());
+	if (HOTSPOT_EXTERNAL) {
+		system(std::string("./HotSpot.sh " + fp.getBenchmark() + " " + std::to_string(fp.getLayers())).c_str());
+	}
 
 	// re-generate original power maps
 	//
@@ -548,7 +543,9 @@ int main (int argc, char** argv) {
 	IO::writeMaps(fp, IO::MAPS_FLAGS::THERMAL_HOTSPOT, "_postprocessed");
 
 	// final HotSpot.sh system call
-	system(std::string("./HotSpot.sh " + fp.getBenchmark() + "_postprocessed " + std::to_string(fp.getLayers())).c_str());
+	if (HOTSPOT_EXTERNAL) {
+		system(std::string("./HotSpot.sh " + fp.getBenchmark() + "_postprocessed " + std::to_string(fp.getLayers())).c_str());
+	}
 
 	std::cout << std::endl;
 	std::cout << "Log for previous iteration's final results" << std::endl;
@@ -568,7 +565,28 @@ int main (int argc, char** argv) {
 
 	// now, read in the final HotSpot simulation result
 	//
-	parseHotSpotFiles(fp, "_postprocessed", thermal_maps_HotSpot);
+	if (HOTSPOT_EXTERNAL) {
+		parseHotSpotFiles(fp, "_postprocessed", thermal_maps_HotSpot);
+	}
+	// alternatively, run the in-process thermal solver on the final result; the
+	// power maps and TSV densities are already set up accordingly
+	else {
+		fp.performThermalSimulation(true);
+
+		thermal_maps_HotSpot.clear();
+
+		for (int layer = 0; layer < fp.getLayers(); layer++) {
+
+			thermal_maps_HotSpot.emplace_back(thermal_maps_layer_type());
+
+			for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
+				for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+
+					thermal_maps_HotSpot[layer][x][y].temp = fp.getThermalSolver().getTemp(layer, x, y);
+				}
+			}
+		}
+	}
 
 
 	std::cout << std::endl;
@@ -591,7 +609,7 @@ int main (int argc, char** argv) {
 	}
 }
 
-void parseHotSpotFiles(FloorPlanner& fp, unsigned sampling_iter, samples_data_type& temp_samples) {
+void parseHotSpotFiles(FloorPlanner& fp, sample_type& temp_sample) {
 	std::ifstream layer_file;
 	int x, y;
 	double temp;
@@ -627,11 +645,11 @@ void parseHotSpotFiles(FloorPlanner& fp, unsigned sampling_iter, samples_data_ty
 			}
 
 			// memorize temperature value for its respective bin
-			temp_samples[layer][x][y][sampling_iter] = temp;
+			temp_sample[layer][x][y] = temp;
 
 			// DBG output
 			if (DBG_PARSING) {
-				std::cout << "Temp for [layer= " << layer << "][x= " << x << "][y= " << y << "]: " << temp_samples[layer][x][y][sampling_iter] << std::endl;
+				std::cout << "Temp for [layer= " << layer << "][x= " << x << "][y= " << y << "]: " << temp_sample[layer][x][y] << std::endl;
 				std::cout << "Power for [layer= " << layer << "][x= " << x << "][y= " << y << "]: " << fp.getThermalAnalyzer().getPowerMapsOrig()[layer][x][y].power_density << std::endl;
 			}
 		}
@@ -0,0 +1,276 @@
+/*
+ * =====================================================================================
+ *
+ *    Description: Parallel sampling of power and thermal maps w/ streaming per-bin
+ *    statistics, shared by the TSC tools
+ *
+ *    Copyright (C) 2016 Johann Knechtel, johann aett nyu dot edu
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_SAMPLING_TSC
+#define _CORBLIVAR_SAMPLING_TSC
+
+// required Corblivar headers
+#include "../src/FloorPlanner.hpp"
+#include "../src/ThermalAnalyzer.hpp"
+#include "../src/ThermalSolver.hpp"
+#include <random>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <map>
+
+// chunks per thread, i.e., work packages per thread for parallel sampling; several
+// chunks per thread balance the load for varying runtimes of the thermal solver
+static constexpr unsigned SAMPLING_CHUNKS_PER_THREAD = 4;
+
+// type definitions, for shorter notation
+typedef	std::array< std::array<double, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> sample_layer_type;
+typedef	std::vector< sample_layer_type > sample_type;
+
+// online statistics per bin, for power and temperature: mean values, sums of squared
+// deviations from the mean values, and sum of co-deviations; updated w/ Welford's
+// algorithm, thus memory is independent of the number of sampling iterations
+struct BinStatistics {
+	double avg_power = 0.0;
+	double avg_temp = 0.0;
+	double sq_dev_power = 0.0;
+	double sq_dev_temp = 0.0;
+	double co_dev = 0.0;
+};
+typedef	std::array< std::array<BinStatistics, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> statistics_layer_type;
+
+struct SamplingStatistics {
+	unsigned count = 0;
+	std::vector< statistics_layer_type > bins;
+
+	// (re-)initialize for given number of layers
+	void reset(int const& layers) {
+		this->count = 0;
+		this->bins.assign(layers, statistics_layer_type());
+	}
+
+	// update w/ power and temperature maps of one sampling iteration
+	void add(sample_type const& power, sample_type const& temp) {
+		double power_dev, temp_dev;
+
+		this->count++;
+
+		for (unsigned layer = 0; layer < this->bins.size(); layer++) {
+			for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
+				for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+
+					BinStatistics& bin = this->bins[layer][x][y];
+
+					// deviations from previous mean values
+					power_dev = power[layer][x][y] - bin.avg_power;
+					temp_dev = temp[layer][x][y] - bin.avg_temp;
+
+					bin.avg_power += power_dev / this->count;
+					bin.avg_temp += temp_dev / this->count;
+
+					// products of deviations from previous and updated mean values
+					bin.sq_dev_power += power_dev * (power[layer][x][y] - bin.avg_power);
+					bin.sq_dev_temp += temp_dev * (temp[layer][x][y] - bin.avg_temp);
+					bin.co_dev += power_dev * (temp[layer][x][y] - bin.avg_temp);
+				}
+			}
+		}
+	}
+
+	// merge w/ statistics of another, disjoint set of sampling iterations; pairwise
+	// update of Chan et al.
+	void merge(SamplingStatistics const& other) {
+		double power_dev, temp_dev;
+		double weight;
+		unsigned count;
+
+		if (other.count == 0) {
+			return;
+		}
+
+		count = this->count + other.count;
+		weight = static_cast<double>(this->count) * other.count / count;
+
+		for (unsigned layer = 0; layer < this->bins.size(); layer++) {
+			for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
+				for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+
+					BinStatistics& bin = this->bins[layer][x][y];
+					BinStatistics const& other_bin = other.bins[layer][x][y];
+
+					// deviations of mean values
+					power_dev = other_bin.avg_power - bin.avg_power;
+					temp_dev = other_bin.avg_temp - bin.avg_temp;
+
+					bin.avg_power += power_dev * other.count / count;
+					bin.avg_temp += temp_dev * other.count / count;
+
+					bin.sq_dev_power += other_bin.sq_dev_power + power_dev * power_dev * weight;
+					bin.sq_dev_temp += other_bin.sq_dev_temp + temp_dev * temp_dev * weight;
+					bin.co_dev += other_bin.co_dev + power_dev * temp_dev * weight;
+				}
+			}
+		}
+
+		this->count = count;
+	}
+};
+
+// parallel sampling w/ in-process thermal solver; each thread works on its own copies of
+// the blocks, the thermal analyzer and the thermal solver, and each sampling iteration
+// has its own random-number stream derived from the seed and the iteration; the
+// iterations are handled in chunks, whose partial statistics are merged in order of the
+// chunks; the thermal solver is reset for each iteration, i.e., the solution of a previous
+// iteration is not used as initial guess; thus, the statistics are independent of the
+// threads' scheduling; the chunk size is derived from the number of iterations and
+// threads, thus the statistics for different numbers of threads differ by rounding only
+//
+// sampling_threads = 0 refers to the number of hardware threads; the std dev of the
+// Gaussian distribution of power values is set up from the mean value and
+// mean_to_std_dev_factor
+//
+inline void sampleParallel(FloorPlanner& fp, unsigned seed, unsigned const& iterations, unsigned const& sampling_threads, double const& mean_to_std_dev_factor, SamplingStatistics& statistics) {
+	std::vector<std::thread> threads;
+	unsigned thread_count;
+	unsigned chunk_size;
+	unsigned chunk_count;
+	std::atomic<unsigned> next_chunk(0);
+	unsigned next_chunk_to_merge = 0;
+	std::map<unsigned, SamplingStatistics> finished_chunks;
+	unsigned finished_sampling_iters = 0;
+	std::mutex merge_mutex;
+	ThermalSolver::StackParameters const stack_parameters = fp.getThermalStackParameters();
+
+	if (sampling_threads > 0) {
+		thread_count = sampling_threads;
+	}
+	else {
+		thread_count = std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	// several chunks per thread, but at least one iteration per chunk
+	chunk_size = std::max(1u, iterations / (thread_count * SAMPLING_CHUNKS_PER_THREAD));
+	chunk_count = (iterations + chunk_size - 1) / chunk_size;
+
+	thread_count = std::max(1u, std::min(thread_count, chunk_count));
+
+	std::cout << std::endl;
+	std::cout << "Parallel sampling w/ " << thread_count << " threads" << std::endl;
+	std::cout << "------------------------------" << std::endl;
+
+	auto sample = [&]() {
+		// thread-local copies
+		std::vector<Block> blocks = fp.getBlocks();
+		ThermalAnalyzer thermalAnalyzer = fp.getThermalAnalyzer();
+		ThermalSolver thermalSolver;
+		sample_type power_sample(fp.getLayers());
+		sample_type temp_sample(fp.getLayers());
+		unsigned chunk;
+
+		while ((chunk = next_chunk++) < chunk_count) {
+
+			SamplingStatistics chunk_statistics;
+			chunk_statistics.reset(fp.getLayers());
+
+			for (unsigned sampling_iter = chunk * chunk_size; sampling_iter < std::min((chunk + 1) * chunk_size, iterations); sampling_iter++) {
+
+				std::seed_seq seeds{seed, sampling_iter};
+				std::default_random_engine random_generator(seeds);
+
+				// first, randomly vary power densities in blocks
+				//
+				for (Block& b : blocks) {
+
+					// restore original value, used as mean for Gaussian distribution of power densities
+					b.power_density_unscaled = b.power_density_unscaled_back;
+
+					// calculate new power value, based on Gaussian distribution
+					std::normal_distribution<double> gaussian(b.power_density_unscaled, b.power_density_unscaled * mean_to_std_dev_factor);
+
+					b.power_density_unscaled = gaussian(random_generator);
+				}
+
+				// second, generate new power maps
+				//
+				thermalAnalyzer.generatePowerMaps(fp.getLayers(), blocks, fp.getOutline(), fp.getPowerBlurringParameters());
+
+				// copy data from power maps into local data structure power_sample
+				//
+				for (int layer = 0; layer < fp.getLayers(); layer++) {
+					for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
+						for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+
+							power_sample[layer][x][y] = thermalAnalyzer.getPowerMapsOrig()[layer][x][y].power_density;
+						}
+					}
+				}
+
+				// third, run thermal solver on this new map; the TSV densities
+				// are reset along with the power maps, restore them,
+				// including any dummy TSVs
+				//
+				thermalAnalyzer.adaptPowerMapsTSVs(fp.getLayers(), fp.getTSVs(), fp.getDummyTSVs(), fp.getPowerBlurringParameters());
+				thermalSolver.resetSolution();
+				thermalSolver.performSteadyStateSimulation(stack_parameters, blocks, fp.getWires(), fp.getOutline(), thermalAnalyzer.getPowerMaps());
+
+				// fourth, copy the temperatures into local data structure
+				// temp_sample
+				//
+				for (int layer = 0; layer < fp.getLayers(); layer++) {
+					for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
+						for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+
+							temp_sample[layer][x][y] = thermalSolver.getTemp(layer, x, y);
+						}
+					}
+				}
+
+				// fifth, update the chunk's statistics
+				//
+				chunk_statistics.add(power_sample, temp_sample);
+			}
+
+			// merge the chunk's statistics in order of chunks; chunks finished
+			// out of order are kept until all their predecessors are merged
+			//
+			std::lock_guard<std::mutex> lock(merge_mutex);
+
+			finished_sampling_iters += chunk_statistics.count;
+			finished_chunks.emplace(chunk, std::move(chunk_statistics));
+
+			while (!finished_chunks.empty() && finished_chunks.begin()->first == next_chunk_to_merge) {
+
+				statistics.merge(finished_chunks.begin()->second);
+
+				finished_chunks.erase(finished_chunks.begin());
+				next_chunk_to_merge++;
+			}
+
+			std::cout << "Sampling iterations finished: " << finished_sampling_iters << "/" << iterations << std::endl;
+		}
+	};
+
+	for (unsigned t = 0; t < thread_count; t++) {
+		threads.emplace_back(sample);
+	}
+	for (std::thread& t : threads) {
+		t.join();
+	}
+}
+
+#endif
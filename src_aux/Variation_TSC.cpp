@@ -25,6 +25,7 @@
 #include "../src/CorblivarCore.hpp"
 #include "../src/FloorPlanner.hpp"
 #include "../src/IO.hpp"
+#include "Sampling_TSC.hpp"
 #include <random>
 #include <chrono>
 
@@ -33,28 +34,27 @@ static constexpr bool DBG = false;
 static constexpr bool DBG_PARSING = false;
 
 // global fixed parameters
+// run external HotSpot via HotSpot.sh, or the in-process thermal solver; the latter
+// is not validated against HotSpot yet, thus HotSpot is run by default
+static constexpr bool HOTSPOT_EXTERNAL = true;
 static constexpr unsigned SAMPLING_ITERATIONS = 100;
+// threads for parallel sampling; 0 refers to the number of hardware threads
+static constexpr unsigned SAMPLING_THREADS = 0;
 // for the Gaussian distribution of power values; the std dev is set up from the mean value and this factor
 static constexpr double MEAN_TO_STD_DEV_FACTOR = 0.1;
 
-// type definitions, for shorter notation
-typedef	std::array< std::array< std::array<double, SAMPLING_ITERATIONS> , ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> samples_data_layer_type;
-typedef	std::vector< samples_data_layer_type > samples_data_type;
-
 // forward declaration
-void parseHotSpotFiles(FloorPlanner& fp, unsigned sampling_iter, samples_data_type& temp_samples);
+void parseHotSpotFiles(FloorPlanner& fp, sample_type& temp_sample);
 void writeHotSpotPtrace(FloorPlanner& fp);
 void writeHotSpotFiles__passiveSi_bonding(FloorPlanner& fp);
 
 int main (int argc, char** argv) {
 	FloorPlanner fp;
 
-	samples_data_type temp_samples;
-	samples_data_type power_samples;
+	SamplingStatistics statistics;
 
 	double avg_power, avg_temp;
 	double std_dev_power, std_dev_temp;
-	double cur_power_dev, cur_temp_dev;
 
 	double cov;
 
@@ -116,83 +116,93 @@ int main (int argc, char** argv) {
 	fp.finalize(corb, false);
 	std::cout << std::endl;
 
-	// allocate vectors
-	for (int layer = 0; layer < fp.getLayers(); layer++) {
-
-		power_samples.emplace_back(samples_data_layer_type());
-		temp_samples.emplace_back(samples_data_layer_type());
-	}
+	// allocate statistics
+	statistics.reset(fp.getLayers());
 
 	// generate power data and gather related HotSpot simulation temperature data
 	//
-	for (unsigned sampling_iter = 0; sampling_iter < SAMPLING_ITERATIONS; sampling_iter++) {
+	// the in-process thermal solver allows for parallel sampling
+	if (!HOTSPOT_EXTERNAL) {
+		sampleParallel(fp, random_generator(), SAMPLING_ITERATIONS, SAMPLING_THREADS, MEAN_TO_STD_DEV_FACTOR, statistics);
+	}
+	// the external HotSpot runs are working on shared files, thus sampling has to
+	// be sequential
+	else {
+		sample_type power_sample(fp.getLayers());
+		sample_type temp_sample(fp.getLayers());
 
-		std::cout << std::endl;
-		std::cout << "Sampling iteration: " << (sampling_iter + 1) << "/" << SAMPLING_ITERATIONS << std::endl;
-		std::cout << "------------------------------" << std::endl;
+		for (unsigned sampling_iter = 0; sampling_iter < SAMPLING_ITERATIONS; sampling_iter++) {
 
-		// first, randomly vary power densities in blocks
-		//
-		for (Block const& b : fp.getBlocks()) {
+			std::cout << std::endl;
+			std::cout << "Sampling iteration: " << (sampling_iter + 1) << "/" << SAMPLING_ITERATIONS << std::endl;
+			std::cout << "------------------------------" << std::endl;
 
-			// restore original value, used as mean for Gaussian distribution of power densities
-			b.power_density_unscaled = b.power_density_unscaled_back;
+			// first, randomly vary power densities in blocks
+			//
+			for (Block const& b : fp.getBlocks()) {
 
-			// calculate new power value, based on Gaussian distribution
-			std::normal_distribution<double> gaussian(b.power_density_unscaled, b.power_density_unscaled * MEAN_TO_STD_DEV_FACTOR);
+				// restore original value, used as mean for Gaussian distribution of power densities
+				b.power_density_unscaled = b.power_density_unscaled_back;
 
-			b.power_density_unscaled = gaussian(random_generator);
+				// calculate new power value, based on Gaussian distribution
+				std::normal_distribution<double> gaussian(b.power_density_unscaled, b.power_density_unscaled * MEAN_TO_STD_DEV_FACTOR);
 
-			if (DBG) {
-				std::cout << "Block " << b.id << ":" << std::endl;
-				std::cout << " Original power = " << b.power_density_unscaled_back << std::endl;
-				std::cout << " New random power = " << b.power_density_unscaled << std::endl;
+				b.power_density_unscaled = gaussian(random_generator);
+
+				if (DBG) {
+					std::cout << "Block " << b.id << ":" << std::endl;
+					std::cout << " Original power = " << b.power_density_unscaled_back << std::endl;
+					std::cout << " New random power = " << b.power_density_unscaled << std::endl;
+				}
 			}
-		}
 
-		// second, generate new power maps
-		//
-		fp.editThermalAnalyzer().generatePowerMaps(fp.getLayers(), fp.getBlocks(), fp.getOutline(), fp.getPowerBlurringParameters());
+			// second, generate new power maps
+			//
+			fp.editThermalAnalyzer().generatePowerMaps(fp.getLayers(), fp.getBlocks(), fp.getOutline(), fp.getPowerBlurringParameters());
 
-		// copy data from Corblivar power maps into local data structure power_samples
-		//
-		for (int layer = 0; layer < fp.getLayers(); layer++) {
-			for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-				for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+			// copy data from Corblivar power maps into local data structure power_sample
+			//
+			for (int layer = 0; layer < fp.getLayers(); layer++) {
+				for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
+					for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
 
-					power_samples[layer][x][y][sampling_iter] = fp.getThermalAnalyzer().getPowerMapsOrig()[layer][x][y].power_density;
+						power_sample[layer][x][y] = fp.getThermalAnalyzer().getPowerMapsOrig()[layer][x][y].power_density;
+					}
 				}
 			}
-		}
-
-		// third, run HotSpot on this new map
-		//
-		// generate new ptrace file first
-		writeHotSpotPtrace(fp);
-		// HotSpot.sh system call
-		system(std::string("./HotSpot.sh " + fp.getBenchmark() + " " + std::to_string(fp.getLayers())).c_str());
-
-		// fourth, read in the new HotSpot results into local data structure temp_samples
-		//
-		parseHotSpotFiles(fp, sampling_iter, temp_samples);
 
+			// third, run HotSpot on this new map
+			//
+			// generate new ptrace file first
+			writeHotSpotPtrace(fp);
+			// HotSpot.sh system call
+			system(std::string("./HotSpot.sh " + fp.getBenchmark() + " " + std::to_string(fp.getLayers())).c_str());
 
-		if (DBG) {
-			std::cout << "Printing gathered power/temperature data for sampling iteration " << sampling_iter << std::endl;
-			std::cout << std::endl;
+			// fourth, read in the new HotSpot results into local data structure temp_sample
+			//
+			parseHotSpotFiles(fp, temp_sample);
 
-			for (int layer = 0; layer < fp.getLayers(); layer++) {
-				std::cout << " Layer " << layer << std::endl;
+			if (DBG) {
+				std::cout << "Printing gathered power/temperature data for sampling iteration " << sampling_iter << std::endl;
 				std::cout << std::endl;
 
-				for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-					for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+				for (int layer = 0; layer < fp.getLayers(); layer++) {
+					std::cout << " Layer " << layer << std::endl;
+					std::cout << std::endl;
+
+					for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
+						for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
 
-						std::cout << "  Power[" << x << "][" << y << "]: " << power_samples[layer][x][y][sampling_iter] << std::endl;
-						std::cout << "  Temp [" << x << "][" << y << "]: " << temp_samples[layer][x][y][sampling_iter] << std::endl;
+							std::cout << "  Power[" << x << "][" << y << "]: " << power_sample[layer][x][y] << std::endl;
+							std::cout << "  Temp [" << x << "][" << y << "]: " << temp_sample[layer][x][y] << std::endl;
+						}
 					}
 				}
 			}
+
+			// fifth, update the statistics
+			//
+			statistics.add(power_sample, temp_sample);
 		}
 	}
 
@@ -217,19 +227,10 @@ int main (int argc, char** argv) {
 		for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
 			for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
 
-				avg_power = avg_temp = 0.0;
-				cov = std_dev_power = std_dev_temp = 0.0;
-				corr = 0.0;
-
-				// first pass: determine avg values
-				//
-				for (unsigned sampling_iter = 0; sampling_iter < SAMPLING_ITERATIONS; sampling_iter++) {
+				BinStatistics const& bin = statistics.bins[layer][x][y];
 
-					avg_power += power_samples[layer][x][y][sampling_iter];
-					avg_temp += temp_samples[layer][x][y][sampling_iter];
-				}
-				avg_power /= SAMPLING_ITERATIONS;
-				avg_temp /= SAMPLING_ITERATIONS;
+				avg_power = bin.avg_power;
+				avg_temp = bin.avg_temp;
 
 				// dbg output
 				if (DBG) {
@@ -237,28 +238,12 @@ int main (int argc, char** argv) {
 					std::cout << " Avg power: " << avg_power << std::endl;
 					std::cout << " Avg temp: " << avg_temp << std::endl;
 				}
-				
-				// second pass: determine covariance and standard deviations
-				//
-				for (unsigned sampling_iter = 0; sampling_iter < SAMPLING_ITERATIONS; sampling_iter++) {
 
-					// deviations of current values from avg values
-					cur_power_dev = power_samples[layer][x][y][sampling_iter] - avg_power;
-					cur_temp_dev = temp_samples[layer][x][y][sampling_iter] - avg_temp;
-
-					// covariance
-					cov += cur_power_dev * cur_temp_dev;
-
-					// standard deviation, calculate its sqrt later on
-					std_dev_power += std::pow(cur_power_dev, 2.0);
-					std_dev_temp += std::pow(cur_temp_dev, 2.0);
-				}
-				cov /= SAMPLING_ITERATIONS;
-				std_dev_power /= SAMPLING_ITERATIONS;
-				std_dev_temp /= SAMPLING_ITERATIONS;
-
-				std_dev_power = std::sqrt(std_dev_power);
-				std_dev_temp = std::sqrt(std_dev_temp);
+				// covariance and standard deviations
+				//
+				cov = bin.co_dev / statistics.count;
+				std_dev_power = std::sqrt(bin.sq_dev_power / statistics.count);
+				std_dev_temp = std::sqrt(bin.sq_dev_temp / statistics.count);
 
 				// calculate Pearson correlation: covariance over product of standard deviations
 				//
@@ -285,7 +270,7 @@ int main (int argc, char** argv) {
 	}
 }
 
-void parseHotSpotFiles(FloorPlanner& fp, unsigned sampling_iter, samples_data_type& temp_samples) {
+void parseHotSpotFiles(FloorPlanner& fp, sample_type& temp_sample) {
 	std::ifstream layer_file;
 	int x, y;
 	double temp;
@@ -321,11 +306,11 @@ void parseHotSpotFiles(FloorPlanner& fp, unsigned sampling_iter, samples_data_ty
 			}
 
 			// memorize temperature value for its respective bin
-			temp_samples[layer][x][y][sampling_iter] = temp;
+			temp_sample[layer][x][y] = temp;
 
 			// DBG output
 			if (DBG_PARSING) {
-				std::cout << "Temp for [layer= " << layer << "][x= " << x << "][y= " << y << "]: " << temp_samples[layer][x][y][sampling_iter] << std::endl;
+				std::cout << "Temp for [layer= " << layer << "][x= " << x << "][y= " << y << "]: " << temp_sample[layer][x][y] << std::endl;
 				std::cout << "Power for [layer= " << layer << "][x= " << x << "][y= " << y << "]: " << fp.getThermalAnalyzer().getPowerMapsOrig()[layer][x][y].power_density << std::endl;
 			}
 		}